@@ -435,7 +435,7 @@ Rectangle {
 		anchors.right: parent.right
 		anchors.rightMargin: 8 * scale_factor
 		visible: selected_site !== null && selected_site.game_data.can_have_population() && selected_site.game_data.is_built() && !selected_garrison && viewing_population_units
-		population_units: selected_site ? selected_site.game_data.population_units : []
+		population_units: selected_site ? selected_site.game_data.population_unit_model : null
 	}
 	
 	PortraitButton {
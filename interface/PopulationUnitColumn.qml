@@ -8,7 +8,7 @@ Flickable {
 	boundsBehavior: Flickable.StopAtBounds
 	clip: true
 	
-	property var population_units: []
+	property var population_units: null
 	
 	Column {
 		id: population_unit_column
@@ -21,7 +21,7 @@ Flickable {
 			Row {
 				spacing: 4 * scale_factor
 				
-				readonly property var population_unit: model.modelData
+				readonly property var population_unit: model.object
 				
 				Item {
 					id: population_unit_icon_area
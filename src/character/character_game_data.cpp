@@ -625,7 +625,7 @@ QCoro::Task<void> character_game_data::do_events()
 
 bool character_game_data::is_ai() const
 {
-	return this->character != game::get()->get_player_character();
+	return this->character != game::get()->get_player_character() || game::get()->is_player_ai_controlled();
 }
 
 QCoro::Task<void> character_game_data::apply_species_and_class(const int level, const bool apply_history)
@@ -1232,6 +1232,10 @@ void character_game_data::set_domain(const metternich::domain *domain)
 
 	if (this->get_domain() != nullptr) {
 		this->get_domain()->get_game_data()->add_character(this->character);
+		game::get()->remove_available_homed_character(this->character);
+	} else if (this->get_home_site() != nullptr && !this->is_dead() && this->get_start_date() <= game::get()->get_date() && vector::contains(this->get_home_site()->get_game_data()->get_homed_characters(), this->character)) {
+		//the character can be recruited again by the owner of their home site
+		game::get()->add_available_homed_character(this->character);
 	}
 
 	if (game::get()->is_running()) {
@@ -0,0 +1,109 @@
+#include "metternich.h"
+
+#include "database/database_setup.h"
+
+#include "character/bloodline_strength_category.h"
+#include "character/character_attribute_type.h"
+#include "character/character_defines.h"
+#include "character/profession_profitability.h"
+#include "character/starting_age_category.h"
+#include "culture/cultural_group_rank.h"
+#include "database/database.h"
+#include "database/database_enum_util.h"
+#include "database/defines.h"
+#include "database/preferences.h"
+#include "domain/country_type.h"
+#include "domain/diplomacy_state.h"
+#include "domain/domain_tier.h"
+#include "domain/idea_type.h"
+#include "domain/succession_gender_type.h"
+#include "domain/succession_type.h"
+#include "economy/commodity_type.h"
+#include "economy/food_type.h"
+#include "economy/province_taxation_type.h"
+#include "game/attack_result.h"
+#include "game/battle_resolution_type.h"
+#include "game/decision_type.h"
+#include "game/event_trigger.h"
+#include "item/affix_type.h"
+#include "language/grammatical_gender.h"
+#include "language/word_type.h"
+#include "map/elevation_type.h"
+#include "map/forestation_type.h"
+#include "map/moisture_type.h"
+#include "map/site_type.h"
+#include "map/temperature_type.h"
+#include "population/population_defines.h"
+#include "population/population_strata.h"
+#include "species/geological_era.h"
+#include "species/taxonomic_rank.h"
+#include "spell/spell_target.h"
+#include "ui/ui_defines.h"
+#include "unit/military_unit_category.h"
+#include "unit/military_unit_domain.h"
+#include "unit/transporter_category.h"
+#include "util/gender.h"
+#include "util/log_util.h"
+
+namespace metternich::database_setup {
+
+void add_defines()
+{
+	database::get()->add_defines(defines::get());
+	database::get()->add_defines(character_defines::get());
+	database::get()->add_defines(population_defines::get());
+	database::get()->add_defines(ui_defines::get());
+}
+
+void register_enums()
+{
+	database_util::register_enum<affix_type>();
+	database_util::register_enum<attack_result>();
+	database_util::register_enum<battle_resolution_type>();
+	database_util::register_enum<bloodline_strength_category>();
+	database_util::register_enum<character_attribute_type>();
+	database_util::register_enum<commodity_type>();
+	database_util::register_enum<country_type>();
+	database_util::register_enum<cultural_group_rank>();
+	database_util::register_enum<decision_type>();
+	database_util::register_enum<diplomacy_state>();
+	database_util::register_enum<domain_tier>();
+	database_util::register_enum<elevation_type>();
+	database_util::register_enum<event_trigger>();
+	database_util::register_enum<food_type>();
+	database_util::register_enum<forestation_type>();
+	database_util::register_enum<gender>();
+	database_util::register_enum<geological_era>();
+	database_util::register_enum<grammatical_gender>();
+	database_util::register_enum<idea_type>();
+	database_util::register_enum<log_level>();
+	database_util::register_enum<military_unit_category>();
+	database_util::register_enum<military_unit_domain>();
+	database_util::register_enum<moisture_type>();
+	database_util::register_enum<population_strata>();
+	database_util::register_enum<profession_profitability>();
+	database_util::register_enum<province_taxation_type>();
+	database_util::register_enum<site_type>();
+	database_util::register_enum<spell_target>();
+	database_util::register_enum<starting_age_category>();
+	database_util::register_enum<succession_gender_type>();
+	database_util::register_enum<succession_type>();
+	database_util::register_enum<taxonomic_rank>();
+	database_util::register_enum<temperature_type>();
+	database_util::register_enum<transporter_category>();
+	database_util::register_enum<word_type>();
+}
+
+QCoro::Task<void> load()
+{
+	co_await database::get()->load(true);
+	database::get()->load_defines();
+	co_await database::get()->load(false);
+
+	//load the preferences before initializing the database, so that is any initialization depends on the scale factor, it can work properly
+	preferences::get()->load();
+
+	database::get()->initialize();
+}
+
+}
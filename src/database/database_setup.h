@@ -0,0 +1,12 @@
+#pragma once
+
+namespace metternich::database_setup {
+
+//registers the defines and enums used by the database, which must be done before loading it
+extern void add_defines();
+extern void register_enums();
+
+[[nodiscard]]
+extern QCoro::Task<void> load();
+
+}
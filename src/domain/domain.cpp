@@ -267,6 +267,11 @@ domain_technology *domain::get_technology() const
 
 void domain::reset_turn_data()
 {
+	if (this->turn_data != nullptr) {
+		this->turn_data->reset();
+		return;
+	}
+
 	this->turn_data = make_qunique<domain_turn_data>(this);
 	emit turn_data_changed();
 }
@@ -19,15 +19,15 @@
 #include "map/province.h"
 #include "map/province_game_data.h"
 #include "map/province_map_data.h"
+#include "map/province_pathfinder.h"
 #include "map/terrain_type.h"
-#include "map/tile.h"
 #include "religion/religion.h"
 #include "script/opinion_modifier.h"
+#include "ui/image_scaling.h"
 #include "util/assert_util.h"
 #include "util/image_util.h"
 #include "util/map_util.h"
-
-#include "xbrz.h"
+#include "util/point_util.h"
 
 #include <magic_enum/magic_enum.hpp>
 
@@ -127,6 +127,8 @@ QCoro::Task<void> domain_diplomacy::set_overlord(const metternich::domain *overl
 		co_return;
 	}
 
+	province_pathfinder::get()->invalidate();
+
 	const metternich::domain *old_realm = this->get_game_data()->get_realm();
 
 	if (overlord != nullptr && overlord->get_game_data()->get_tier() <= this->get_game_data()->get_tier()) {
@@ -173,12 +175,10 @@ bool domain_diplomacy::is_vassal_of(const metternich::domain *domain) const
 
 bool domain_diplomacy::is_any_vassal_of(const metternich::domain *domain) const
 {
-	if (this->is_vassal_of(domain)) {
-		return true;
-	}
-
-	if (this->get_overlord() != nullptr) {
-		return this->get_overlord()->get_diplomacy()->is_any_vassal_of(domain);
+	for (const metternich::domain *overlord = this->get_overlord(); overlord != nullptr; overlord = overlord->get_diplomacy()->get_overlord()) {
+		if (overlord == domain) {
+			return true;
+		}
 	}
 
 	return false;
@@ -191,18 +191,8 @@ bool domain_diplomacy::is_overlord_of(const metternich::domain *domain) const
 
 bool domain_diplomacy::is_any_overlord_of(const metternich::domain *domain) const
 {
-	if (this->is_overlord_of(domain)) {
-		return true;
-	}
-
-	const std::vector<const metternich::domain *> vassals = this->get_vassals();
-	for (const metternich::domain *vassal : this->get_vassals()) {
-		if (vassal->get_diplomacy()->is_any_overlord_of(domain)) {
-			return true;
-		}
-	}
-
-	return false;
+	//walk up the other domain's overlord chain instead of down the vassal tree, since realm hierarchies are shallow but can be wide
+	return domain->get_diplomacy()->is_any_vassal_of(this->domain);
 }
 
 QCoro::Task<void> domain_diplomacy::set_subject_type(const metternich::subject_type *subject_type)
@@ -261,6 +251,8 @@ QCoro::Task<void> domain_diplomacy::set_diplomacy_state(const metternich::domain
 		co_return;
 	}
 
+	province_pathfinder::get()->invalidate();
+
 	if (is_vassalage_diplomacy_state(state)) {
 		co_await this->set_overlord(other_domain);
 	} else {
@@ -280,6 +272,17 @@ QCoro::Task<void> domain_diplomacy::set_diplomacy_state(const metternich::domain
 		this->change_diplomacy_state_count(state, 1);
 	}
 
+	if (is_overlordship_diplomacy_state(old_state) != is_overlordship_diplomacy_state(state)) {
+		const auto vassal_iterator = std::lower_bound(this->vassals.begin(), this->vassals.end(), other_domain, domain_compare());
+
+		if (is_overlordship_diplomacy_state(state)) {
+			this->vassals.insert(vassal_iterator, other_domain);
+		} else {
+			assert_throw(vassal_iterator != this->vassals.end() && *vassal_iterator == other_domain);
+			this->vassals.erase(vassal_iterator);
+		}
+	}
+
 	if (is_overlordship_diplomacy_state(old_state) || is_overlordship_diplomacy_state(state)) {
 		if (game::get()->is_loaded()) {
 			this->get_game_data()->calculate_realm_territory_rect();
@@ -419,10 +422,7 @@ void domain_diplomacy::set_consulate(const metternich::domain *other_domain, con
 int domain_diplomacy::get_opinion_of(const metternich::domain *other) const
 {
 	int opinion = this->get_base_opinion(other);
-
-	for (const auto &[modifier, duration] : this->get_opinion_modifiers_for(other)) {
-		opinion += modifier->get_value();
-	}
+	opinion += this->get_opinion_modifier_value(other);
 
 	opinion = std::clamp(opinion, domain::min_opinion, domain::max_opinion);
 
@@ -452,58 +452,88 @@ void domain_diplomacy::set_base_opinion(const metternich::domain *other, const i
 	}
 }
 
+void domain_diplomacy::apply_pending_base_opinion_changes()
+{
+	for (const auto &[other, change] : this->pending_base_opinion_changes) {
+		this->change_base_opinion(other, change);
+	}
+
+	this->pending_base_opinion_changes.clear();
+}
+
 void domain_diplomacy::add_opinion_modifier(const metternich::domain *other, const opinion_modifier *modifier, const int duration)
 {
-	this->opinion_modifiers[other][modifier] = std::max(this->opinion_modifiers[other][modifier], duration);
+	opinion_modifier_map<int> &opinion_modifiers = this->opinion_modifiers[other];
+
+	const auto [iterator, inserted] = opinion_modifiers.try_emplace(modifier, duration);
+	if (inserted) {
+		this->change_opinion_modifier_value(other, modifier->get_value());
+	} else {
+		iterator->second = std::max(iterator->second, duration);
+	}
 }
 
 void domain_diplomacy::remove_opinion_modifier(const metternich::domain *other, const opinion_modifier *modifier)
 {
-	opinion_modifier_map<int> &opinion_modifiers = this->opinion_modifiers[other];
-	opinion_modifiers.erase(modifier);
+	const auto find_iterator = this->opinion_modifiers.find(other);
+	if (find_iterator == this->opinion_modifiers.end()) {
+		return;
+	}
+
+	opinion_modifier_map<int> &opinion_modifiers = find_iterator->second;
+	if (opinion_modifiers.erase(modifier) > 0) {
+		this->change_opinion_modifier_value(other, -modifier->get_value());
+	}
 
 	if (opinion_modifiers.empty()) {
-		this->opinion_modifiers.erase(other);
+		this->opinion_modifiers.erase(find_iterator);
 	}
 }
 
 void domain_diplomacy::decrement_opinion_modifiers()
 {
-	domain_map<std::vector<const opinion_modifier *>> opinion_modifiers_to_remove;
+	//expire modifiers in place, without collecting them in a temporary container first
+	for (auto domain_iterator = this->opinion_modifiers.begin(); domain_iterator != this->opinion_modifiers.end();) {
+		const metternich::domain *country = domain_iterator->first;
+		opinion_modifier_map<int> &opinion_modifier_map = domain_iterator->second;
+
+		for (auto modifier_iterator = opinion_modifier_map.begin(); modifier_iterator != opinion_modifier_map.end();) {
+			int &duration = modifier_iterator->second;
 
-	for (auto &[country, opinion_modifier_map] : this->opinion_modifiers) {
-		for (auto &[modifier, duration] : opinion_modifier_map) {
 			if (duration == -1) {
 				//eternal
+				++modifier_iterator;
 				continue;
 			}
 
 			--duration;
 
 			if (duration == 0) {
-				opinion_modifiers_to_remove[country].push_back(modifier);
+				this->change_opinion_modifier_value(country, -modifier_iterator->first->get_value());
+				modifier_iterator = opinion_modifier_map.erase(modifier_iterator);
+			} else {
+				++modifier_iterator;
 			}
 		}
-	}
 
-	for (const auto &[country, opinion_modifiers] : opinion_modifiers_to_remove) {
-		for (const opinion_modifier *modifier : opinion_modifiers) {
-			this->remove_opinion_modifier(country, modifier);
+		if (opinion_modifier_map.empty()) {
+			domain_iterator = this->opinion_modifiers.erase(domain_iterator);
+		} else {
+			++domain_iterator;
 		}
 	}
 }
 
-std::vector<const metternich::domain *> domain_diplomacy::get_vassals() const
+void domain_diplomacy::change_opinion_modifier_value(const metternich::domain *other, const int change)
 {
-	std::vector<const metternich::domain *> vassals;
-
-	for (const auto &[domain, diplomacy_state] : this->diplomacy_states) {
-		if (is_overlordship_diplomacy_state(diplomacy_state)) {
-			vassals.push_back(domain);
-		}
+	if (change == 0) {
+		return;
 	}
 
-	return vassals;
+	const int new_value = (this->opinion_modifier_values[other] += change);
+	if (new_value == 0) {
+		this->opinion_modifier_values.erase(other);
+	}
 }
 
 QVariantList domain_diplomacy::get_vassals_qvariant_list() const
@@ -539,23 +569,17 @@ const QColor &domain_diplomacy::get_diplomatic_map_color() const
 	return this->domain->get_color();
 }
 
-QImage domain_diplomacy::prepare_diplomatic_map_image() const
+QRect domain_diplomacy::get_diplomatic_map_pixel_rect(const QRect &territory_rect)
 {
-	assert_throw(this->get_game_data()->get_territory_rect().width() > 0);
-	assert_throw(this->get_game_data()->get_territory_rect().height() > 0);
+	assert_throw(territory_rect.width() > 0);
+	assert_throw(territory_rect.height() > 0);
 
 	const decimillesimal_int &tile_scale = map::get()->get_diplomatic_map_tile_scale();
-	QSize image_size;
 	if (tile_scale < 1) {
-		image_size = QSize((this->get_game_data()->get_territory_rect().width() * tile_scale).to_ceil_int(), (this->get_game_data()->get_territory_rect().height() * tile_scale).to_ceil_int());
-	} else {
-		image_size = this->get_game_data()->get_territory_rect().size();
+		return QRect(territory_rect.topLeft() * tile_scale, QSize((territory_rect.width() * tile_scale).to_ceil_int(), (territory_rect.height() * tile_scale).to_ceil_int()));
 	}
 
-	QImage image(image_size, QImage::Format_RGBA8888);
-	image.fill(Qt::transparent);
-
-	return image;
+	return territory_rect;
 }
 
 QImage domain_diplomacy::finalize_diplomatic_map_image(QImage &&image)
@@ -567,9 +591,7 @@ QImage domain_diplomacy::finalize_diplomatic_map_image(QImage &&image)
 	if (tile_scale > 1) {
 		QImage scaled_image;
 
-		scaled_image = image::scale<QImage::Format_ARGB32>(image, centesimal_int(tile_scale), [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-			xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-		});
+		scaled_image = image_scaling::scale(image, centesimal_int(tile_scale));
 
 		image = std::move(scaled_image);
 	}
@@ -621,37 +643,14 @@ void domain_diplomacy::create_diplomatic_map_image()
 		return;
 	}
 
-	const map *map = map::get();
-
-	QImage diplomatic_map_image = this->prepare_diplomatic_map_image();
-	QImage selected_diplomatic_map_image = diplomatic_map_image;
-
-	const QColor &color = this->get_diplomatic_map_color();
-	const QColor &selected_color = defines::get()->get_selected_country_color();
+	const QRect &territory_rect = this->get_game_data()->get_territory_rect();
+	QImage diplomatic_map_image = this->compose_diplomatic_map_image(territory_rect, this->create_diplomatic_map_color_table(this->get_diplomatic_map_color()));
+	QImage selected_diplomatic_map_image = this->compose_diplomatic_map_image(territory_rect, this->create_diplomatic_map_color_table(defines::get()->get_selected_country_color()));
 
 	const decimillesimal_int &tile_scale = map::get()->get_diplomatic_map_tile_scale();
 	const QPoint top_left = this->get_game_data()->get_territory_rect().topLeft() * tile_scale;
-
 	const QSize image_size = diplomatic_map_image.size();
 
-	//normalize the tile top left
-	const QPoint tile_top_left = this->get_game_data()->get_territory_rect().topLeft() * tile_scale / tile_scale;
-
-	for (int x = 0; x < image_size.width(); ++x) {
-		for (int y = 0; y < image_size.height(); ++y) {
-			const QPoint pixel_pos = QPoint(x, y);
-			const QPoint relative_tile_pos = tile_scale < 1 ? pixel_pos / tile_scale : pixel_pos;
-			const tile *tile = map->get_tile(tile_top_left + relative_tile_pos);
-
-			if (tile->get_owner() != this->domain) {
-				continue;
-			}
-
-			diplomatic_map_image.setPixelColor(pixel_pos, color);
-			selected_diplomatic_map_image.setPixelColor(pixel_pos, selected_color);
-		}
-	}
-
 	std::shared_ptr<QPromise<QImage>> promise = std::make_shared<QPromise<QImage>>();
 	this->diplomatic_map_image_promise = promise;
 	this->diplomatic_map_image_promise->start();
@@ -693,25 +692,6 @@ void domain_diplomacy::create_diplomatic_map_image()
 	}
 }
 
-QImage domain_diplomacy::prepare_realm_diplomatic_map_image() const
-{
-	assert_throw(this->get_game_data()->get_realm_territory_rect().width() > 0);
-	assert_throw(this->get_game_data()->get_realm_territory_rect().height() > 0);
-
-	const decimillesimal_int &tile_scale = map::get()->get_diplomatic_map_tile_scale();
-	QSize image_size;
-	if (tile_scale < 1) {
-		image_size = QSize((this->get_game_data()->get_realm_territory_rect().width() * tile_scale).to_ceil_int(), (this->get_game_data()->get_realm_territory_rect().height() * tile_scale).to_ceil_int());
-	} else {
-		image_size = this->get_game_data()->get_realm_territory_rect().size();
-	}
-
-	QImage image(image_size, QImage::Format_RGBA8888);
-	image.fill(Qt::transparent);
-
-	return image;
-}
-
 void domain_diplomacy::create_realm_diplomatic_map_image()
 {
 	if (!this->is_independent() || this->get_game_data()->get_provinces().empty()) {
@@ -726,35 +706,33 @@ void domain_diplomacy::create_realm_diplomatic_map_image()
 	}
 
 	const map *map = map::get();
+	const std::vector<province *> &map_provinces = map->get_provinces();
 
-	QImage diplomatic_map_image = this->prepare_realm_diplomatic_map_image();
-	QImage selected_diplomatic_map_image = diplomatic_map_image;
+	//color the provinces of the whole realm
+	std::vector<QColor> province_colors(map_provinces.size());
+	std::vector<QColor> selected_province_colors(map_provinces.size());
 
 	const QColor &color = this->get_diplomatic_map_color();
 	const QColor &selected_color = defines::get()->get_selected_country_color();
 
-	const decimillesimal_int &tile_scale = map::get()->get_diplomatic_map_tile_scale();
-	const QPoint top_left = this->get_game_data()->get_realm_territory_rect().topLeft() * tile_scale;
-
-	const QSize image_size = diplomatic_map_image.size();
+	for (size_t i = 0; i < map_provinces.size(); ++i) {
+		const metternich::domain *province_owner = map_provinces[i]->get_game_data()->get_owner();
+		if (province_owner == nullptr || province_owner->get_game_data()->get_realm() != this->domain) {
+			continue;
+		}
 
-	//normalize the tile top left
-	const QPoint tile_top_left = this->get_game_data()->get_realm_territory_rect().topLeft() * tile_scale / tile_scale;
+		province_colors[i] = color;
+		selected_province_colors[i] = selected_color;
+	}
 
-	for (int x = 0; x < image_size.width(); ++x) {
-		for (int y = 0; y < image_size.height(); ++y) {
-			const QPoint pixel_pos = QPoint(x, y);
-			const QPoint relative_tile_pos = tile_scale < 1 ? pixel_pos / tile_scale : pixel_pos;
-			const tile *tile = map->get_tile(tile_top_left + relative_tile_pos);
+	const QRect &realm_territory_rect = this->get_game_data()->get_realm_territory_rect();
+	const decimillesimal_int &tile_scale = map->get_diplomatic_map_tile_scale();
+	const QPoint top_left = realm_territory_rect.topLeft() * tile_scale;
 
-			if (tile->get_owner() == nullptr || tile->get_owner()->get_game_data()->get_realm() != this->domain) {
-				continue;
-			}
+	QImage diplomatic_map_image = this->compose_diplomatic_map_image(realm_territory_rect, province_colors);
+	QImage selected_diplomatic_map_image = this->compose_diplomatic_map_image(realm_territory_rect, selected_province_colors);
 
-			diplomatic_map_image.setPixelColor(pixel_pos, color);
-			selected_diplomatic_map_image.setPixelColor(pixel_pos, selected_color);
-		}
-	}
+	const QSize image_size = diplomatic_map_image.size();
 
 	std::shared_ptr<QPromise<QImage>> promise = std::make_shared<QPromise<QImage>>();
 	this->realm_diplomatic_map_image_promise = promise;
@@ -779,140 +757,136 @@ void domain_diplomacy::create_realm_diplomatic_map_image()
 	}
 }
 
-void domain_diplomacy::create_diplomatic_map_mode_image(const diplomatic_map_mode mode)
+QImage domain_diplomacy::compose_diplomatic_map_image(const std::vector<int> &province_raster, const QSize &raster_size, const QRect &pixel_rect, const std::vector<QColor> &province_colors)
 {
-	static const QColor empty_color(Qt::black);
-	static constexpr QColor diplomatic_self_color(170, 148, 214);
-
-	const map *map = map::get();
-
-	QImage image = this->prepare_diplomatic_map_image();
-
-	const decimillesimal_int &tile_scale = map::get()->get_diplomatic_map_tile_scale();
-	const QPoint top_left = this->get_game_data()->get_territory_rect().topLeft() * tile_scale;
+	assert_throw(province_raster.size() == static_cast<size_t>(raster_size.width()) * raster_size.height());
 
-	const QSize image_size = image.size();
+	QImage image(pixel_rect.size(), QImage::Format_RGBA8888);
+	image.fill(Qt::transparent);
 
-	//normalize the tile top left
-	const QPoint tile_top_left = this->get_game_data()->get_territory_rect().topLeft() * tile_scale / tile_scale;
+	//the rect can extend beyond the raster when the image size is rounded up
+	const QRect raster_pixel_rect = pixel_rect.intersected(QRect(QPoint(0, 0), raster_size));
 
-	for (int x = 0; x < image_size.width(); ++x) {
-		for (int y = 0; y < image_size.height(); ++y) {
+	for (int y = raster_pixel_rect.top(); y <= raster_pixel_rect.bottom(); ++y) {
+		for (int x = raster_pixel_rect.left(); x <= raster_pixel_rect.right(); ++x) {
 			const QPoint pixel_pos = QPoint(x, y);
-			const QPoint relative_tile_pos = tile_scale < 1 ? pixel_pos / tile_scale : pixel_pos;
-			const tile *tile = map->get_tile(tile_top_left + relative_tile_pos);
+			const int province_index = province_raster[point::to_index(pixel_pos, raster_size.width())];
 
-			if (tile->get_owner() != this->domain) {
+			if (province_index == -1) {
 				continue;
 			}
 
-			const QColor *color = nullptr;
-
-			switch (mode) {
-				case diplomatic_map_mode::diplomatic:
-					color = &diplomatic_self_color;
-					break;
-				case diplomatic_map_mode::terrain:
-					color = &tile->get_province()->get_map_data()->get_terrain()->get_color();
-					break;
-				case diplomatic_map_mode::cultural: {
-					const metternich::culture *culture = tile->get_province()->get_game_data()->get_culture();
-
-					if (culture != nullptr) {
-						color = &culture->get_color();
-					} else {
-						color = &defines::get()->get_map_blank_color();
-					}
-					break;
-				}
-				case diplomatic_map_mode::religious: {
-					const metternich::religion *religion = tile->get_province()->get_game_data()->get_religion();
-
-					if (religion != nullptr) {
-						color = &religion->get_color();
-					} else {
-						color = &defines::get()->get_map_blank_color();
-					}
-					break;
-				}
-				case diplomatic_map_mode::trade_zone: {
-					const metternich::domain *trade_zone_domain = tile->get_province()->get_game_data()->get_trade_zone_domain();
-
-					if (trade_zone_domain != nullptr) {
-						color = &trade_zone_domain->get_diplomacy()->get_diplomatic_map_color();
-					} else {
-						color = &defines::get()->get_map_blank_color();
-					}
-					break;
-				}
-				case diplomatic_map_mode::temple: {
-					const metternich::domain *temple_domain = tile->get_province()->get_game_data()->get_temple_domain();
-
-					if (temple_domain != nullptr) {
-						color = &temple_domain->get_diplomacy()->get_diplomatic_map_color();
-					} else {
-						color = &defines::get()->get_map_blank_color();
-					}
-					break;
-				}
-				case diplomatic_map_mode::cultural_society: {
-					const metternich::domain *cultural_society_domain = tile->get_province()->get_game_data()->get_cultural_society_domain();
-
-					if (cultural_society_domain != nullptr) {
-						color = &cultural_society_domain->get_diplomacy()->get_diplomatic_map_color();
-					} else {
-						color = &defines::get()->get_map_blank_color();
-					}
-					break;
-				}
+			const QColor &color = province_colors.at(province_index);
+			if (!color.isValid()) {
+				continue;
 			}
 
-			image.setPixelColor(pixel_pos, *color);
+			image.setPixelColor(pixel_pos - pixel_rect.topLeft(), color);
 		}
 	}
 
-	std::shared_ptr<QPromise<QImage>> promise = std::make_shared<QPromise<QImage>>();
-	this->diplomatic_map_mode_image_promises[mode] = promise;
-	promise->start();
+	return image;
+}
 
-	QThreadPool::globalInstance()->start([promise, image = std::move(image)]() mutable {
-		promise->addResult(domain_diplomacy::finalize_diplomatic_map_image(std::move(image)));
-		promise->finish();
-	});
+QImage domain_diplomacy::compose_diplomatic_map_image(const QRect &territory_rect, const std::vector<QColor> &province_colors) const
+{
+	const map *map = map::get();
+	assert_throw(!map->get_diplomatic_map_province_raster().empty());
+	assert_throw(province_colors.size() == map->get_provinces().size());
+
+	return domain_diplomacy::compose_diplomatic_map_image(map->get_diplomatic_map_province_raster(), map->get_diplomatic_map_province_raster_size(), domain_diplomacy::get_diplomatic_map_pixel_rect(territory_rect), province_colors);
 }
 
-void domain_diplomacy::create_diplomacy_state_diplomatic_map_image(const diplomacy_state state)
+std::vector<QColor> domain_diplomacy::create_diplomatic_map_color_table(const QColor &color) const
 {
-	static const QColor empty_color(Qt::black);
+	//provinces not owned by the domain keep an invalid color, so that they are not drawn
+	std::vector<QColor> province_colors(map::get()->get_provinces().size());
 
-	const map *map = map::get();
+	for (const province *province : this->get_game_data()->get_provinces()) {
+		province_colors.at(province->get_map_data()->get_index()) = color;
+	}
 
-	QImage image = this->prepare_diplomatic_map_image();
+	return province_colors;
+}
 
-	const decimillesimal_int &tile_scale = map::get()->get_diplomatic_map_tile_scale();
-	const QPoint top_left = this->get_game_data()->get_territory_rect().topLeft() * tile_scale;
+const QColor &domain_diplomacy::get_diplomatic_map_mode_province_color(const diplomatic_map_mode mode, const province *province)
+{
+	static constexpr QColor diplomatic_self_color(170, 148, 214);
 
-	const QSize image_size = image.size();
+	switch (mode) {
+		case diplomatic_map_mode::diplomatic:
+			return diplomatic_self_color;
+		case diplomatic_map_mode::terrain:
+			return province->get_map_data()->get_terrain()->get_color();
+		case diplomatic_map_mode::cultural: {
+			const metternich::culture *culture = province->get_game_data()->get_culture();
 
-	//normalize the tile top left
-	const QPoint tile_top_left = this->get_game_data()->get_territory_rect().topLeft() * tile_scale / tile_scale;
+			if (culture != nullptr) {
+				return culture->get_color();
+			}
+			break;
+		}
+		case diplomatic_map_mode::religious: {
+			const metternich::religion *religion = province->get_game_data()->get_religion();
 
-	for (int x = 0; x < image_size.width(); ++x) {
-		for (int y = 0; y < image_size.height(); ++y) {
-			const QPoint pixel_pos = QPoint(x, y);
-			const QPoint relative_tile_pos = tile_scale < 1 ? pixel_pos / tile_scale : pixel_pos;
-			const tile *tile = map->get_tile(tile_top_left + relative_tile_pos);
+			if (religion != nullptr) {
+				return religion->get_color();
+			}
+			break;
+		}
+		case diplomatic_map_mode::trade_zone: {
+			const metternich::domain *trade_zone_domain = province->get_game_data()->get_trade_zone_domain();
 
-			if (tile->get_owner() != this->domain) {
-				continue;
+			if (trade_zone_domain != nullptr) {
+				return trade_zone_domain->get_diplomacy()->get_diplomatic_map_color();
 			}
+			break;
+		}
+		case diplomatic_map_mode::temple: {
+			const metternich::domain *temple_domain = province->get_game_data()->get_temple_domain();
 
-			const QColor &color = defines::get()->get_diplomacy_state_color(state);
+			if (temple_domain != nullptr) {
+				return temple_domain->get_diplomacy()->get_diplomatic_map_color();
+			}
+			break;
+		}
+		case diplomatic_map_mode::cultural_society: {
+			const metternich::domain *cultural_society_domain = province->get_game_data()->get_cultural_society_domain();
 
-			image.setPixelColor(pixel_pos, color);
+			if (cultural_society_domain != nullptr) {
+				return cultural_society_domain->get_diplomacy()->get_diplomatic_map_color();
+			}
+			break;
 		}
 	}
 
+	return defines::get()->get_map_blank_color();
+}
+
+void domain_diplomacy::create_diplomatic_map_mode_image(const diplomatic_map_mode mode)
+{
+	//build the color table for the mode, with one entry per province, instead of resolving the color for each pixel
+	std::vector<QColor> province_colors(map::get()->get_provinces().size());
+	for (const province *province : this->get_game_data()->get_provinces()) {
+		province_colors.at(province->get_map_data()->get_index()) = domain_diplomacy::get_diplomatic_map_mode_province_color(mode, province);
+	}
+
+	QImage image = this->compose_diplomatic_map_image(this->get_game_data()->get_territory_rect(), province_colors);
+
+	std::shared_ptr<QPromise<QImage>> promise = std::make_shared<QPromise<QImage>>();
+	this->diplomatic_map_mode_image_promises[mode] = promise;
+	promise->start();
+
+	QThreadPool::globalInstance()->start([promise, image = std::move(image)]() mutable {
+		promise->addResult(domain_diplomacy::finalize_diplomatic_map_image(std::move(image)));
+		promise->finish();
+	});
+}
+
+void domain_diplomacy::create_diplomacy_state_diplomatic_map_image(const diplomacy_state state)
+{
+	QImage image = this->compose_diplomatic_map_image(this->get_game_data()->get_territory_rect(), this->create_diplomatic_map_color_table(defines::get()->get_diplomacy_state_color(state)));
+
 	std::shared_ptr<QPromise<QImage>> promise = std::make_shared<QPromise<QImage>>();
 	this->diplomacy_state_diplomatic_map_image_promises[state] = promise;
 	promise->start();
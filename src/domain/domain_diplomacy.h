@@ -11,6 +11,7 @@ namespace metternich {
 
 class domain;
 class domain_game_data;
+class province;
 class subject_type;
 enum class diplomacy_state;
 enum class diplomatic_map_mode;
@@ -89,6 +90,11 @@ public:
 		this->known_countries.erase(other_domain);
 	}
 
+	const domain_map<diplomacy_state> &get_diplomacy_states() const
+	{
+		return this->diplomacy_states;
+	}
+
 	diplomacy_state get_diplomacy_state(const metternich::domain *other_domain) const;
 	[[nodiscard]] QCoro::Task<void> set_diplomacy_state(const metternich::domain *other_domain, const diplomacy_state state);
 
@@ -145,6 +151,11 @@ public:
 
 	int get_opinion_of(const metternich::domain *other) const;
 
+	const domain_map<int> &get_base_opinions() const
+	{
+		return this->base_opinions;
+	}
+
 	int get_base_opinion(const metternich::domain *other) const
 	{
 		const auto find_iterator = this->base_opinions.find(other);
@@ -162,6 +173,18 @@ public:
 		this->set_base_opinion(other, this->get_base_opinion(other) + change);
 	}
 
+	void add_pending_base_opinion_change(const metternich::domain *other, const int change)
+	{
+		this->pending_base_opinion_changes[other] += change;
+	}
+
+	void apply_pending_base_opinion_changes();
+
+	const domain_map<opinion_modifier_map<int>> &get_opinion_modifiers() const
+	{
+		return this->opinion_modifiers;
+	}
+
 	const opinion_modifier_map<int> &get_opinion_modifiers_for(const metternich::domain *other) const
 	{
 		static const opinion_modifier_map<int> empty_map;
@@ -174,11 +197,26 @@ public:
 		return empty_map;
 	}
 
+	int get_opinion_modifier_value(const metternich::domain *other) const
+	{
+		const auto find_iterator = this->opinion_modifier_values.find(other);
+		if (find_iterator != this->opinion_modifier_values.end()) {
+			return find_iterator->second;
+		}
+
+		return 0;
+	}
+
 	void add_opinion_modifier(const metternich::domain *other, const opinion_modifier *modifier, const int duration);
 	void remove_opinion_modifier(const metternich::domain *other, const opinion_modifier *modifier);
 	void decrement_opinion_modifiers();
+	void change_opinion_modifier_value(const metternich::domain *other, const int change);
+
+	const std::vector<const metternich::domain *> &get_vassals() const
+	{
+		return this->vassals;
+	}
 
-	std::vector<const metternich::domain *> get_vassals() const;
 	QVariantList get_vassals_qvariant_list() const;
 	QVariantList get_subject_type_counts_qvariant_list() const;
 
@@ -189,7 +227,9 @@ public:
 		return this->diplomatic_map_image_promise.get();
 	}
 
-	QImage prepare_diplomatic_map_image() const;
+	//the rect of the unscaled diplomatic map covered by an image of the territory rect
+	static QRect get_diplomatic_map_pixel_rect(const QRect &territory_rect);
+
 	[[nodiscard]] static QImage finalize_diplomatic_map_image(QImage &&image);
 
 	void create_diplomatic_map_image();
@@ -209,7 +249,6 @@ public:
 		return this->realm_diplomatic_map_image_promise.get();
 	}
 
-	QImage prepare_realm_diplomatic_map_image() const;
 
 	void create_realm_diplomatic_map_image();
 
@@ -233,6 +272,12 @@ public:
 		throw std::runtime_error(std::format("No diplomatic map image promise found for mode {}.", static_cast<int>(mode)));
 	}
 
+	//composes the image of the pixel rect of the province raster, with each pixel having the color of its province in the color table, which is indexed as the map's province list; pixels of provinces with an invalid color are left transparent
+	static QImage compose_diplomatic_map_image(const std::vector<int> &province_raster, const QSize &raster_size, const QRect &pixel_rect, const std::vector<QColor> &province_colors);
+
+	QImage compose_diplomatic_map_image(const QRect &territory_rect, const std::vector<QColor> &province_colors) const;
+	std::vector<QColor> create_diplomatic_map_color_table(const QColor &color) const;
+	static const QColor &get_diplomatic_map_mode_province_color(const diplomatic_map_mode mode, const province *province);
 	void create_diplomatic_map_mode_image(const diplomatic_map_mode mode);
 
 	const QPromise<QImage> *get_diplomacy_state_diplomatic_map_image_promise(const diplomacy_state state) const
@@ -293,10 +338,13 @@ private:
 	domain_set known_countries;
 	domain_map<diplomacy_state> diplomacy_states;
 	std::map<diplomacy_state, int> diplomacy_state_counts;
+	std::vector<const metternich::domain *> vassals; //cached from the diplomacy states, sorted in the same order
 	domain_map<diplomacy_state> offered_diplomacy_states;
 	domain_map<const consulate *> consulates;
 	domain_map<int> base_opinions;
+	domain_map<int> pending_base_opinion_changes; //base opinion changes accumulated during trade, applied once the market has cleared
 	domain_map<opinion_modifier_map<int>> opinion_modifiers;
+	domain_map<int> opinion_modifier_values; //the sum of the values of the opinion modifiers for each domain
 	std::shared_ptr<QPromise<QImage>> diplomatic_map_image_promise;
 	std::shared_ptr<QPromise<QImage>> selected_diplomatic_map_image_promise;
 	std::shared_ptr<QPromise<QImage>> realm_diplomatic_map_image_promise;
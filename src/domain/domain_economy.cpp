@@ -20,6 +20,7 @@
 #include "economy/income_transaction_type.h"
 #include "economy/province_taxation_type.h"
 #include "economy/resource.h"
+#include "game/change_notifier.h"
 #include "game/game.h"
 #include "map/map.h"
 #include "map/province.h"
@@ -57,7 +58,8 @@ domain_economy::domain_economy(const metternich::domain *domain, const domain_ga
 			continue;
 		}
 
-		this->add_available_commodity(commodity);
+		//insert directly, since the domain has no sites yet whose employment would need to be checked
+		this->available_commodities.insert(commodity);
 
 		if (commodity->is_tradeable()) {
 			this->add_tradeable_commodity(commodity);
@@ -360,6 +362,29 @@ QVariantList domain_economy::get_available_commodities_qvariant_list() const
 	return container::to_qvariant_list(this->get_available_commodities());
 }
 
+void domain_economy::add_available_commodity(const commodity *commodity)
+{
+	this->available_commodities.insert(commodity);
+
+	//employment availability depends on the available commodities
+	for (const site *site : this->domain->get_game_data()->get_sites()) {
+		site->get_game_data()->set_employment_dirty();
+	}
+
+	emit available_commodities_changed();
+}
+
+void domain_economy::remove_available_commodity(const commodity *commodity)
+{
+	this->available_commodities.erase(commodity);
+
+	for (const site *site : this->domain->get_game_data()->get_sites()) {
+		site->get_game_data()->set_employment_dirty();
+	}
+
+	emit available_commodities_changed();
+}
+
 QVariantList domain_economy::get_tradeable_commodities_qvariant_list() const
 {
 	std::vector<const commodity *> tradeable_commodities = container::to_vector(this->get_tradeable_commodities());
@@ -459,7 +484,7 @@ void domain_economy::set_stored_commodity(const commodity *commodity, const int6
 	}
 
 	if (game::get()->is_running()) {
-		emit stored_commodities_changed();
+		change_notifier::get()->notify(this, &domain_economy::stored_commodities_changed);
 	}
 }
 
@@ -565,7 +590,7 @@ void domain_economy::set_storage_capacity(const int64_t capacity)
 	}
 
 	if (game::get()->is_running()) {
-		emit storage_capacity_changed();
+		change_notifier::get()->notify(this, &domain_economy::storage_capacity_changed);
 	}
 }
 
@@ -600,7 +625,7 @@ QCoro::Task<void> domain_economy::change_commodity_storage_capacity(const commod
 	}
 
 	if (game::get()->is_running()) {
-		emit commodity_storage_capacities_changed();
+		change_notifier::get()->notify(this, &domain_economy::commodity_storage_capacities_changed);
 	}
 }
 
@@ -675,7 +700,7 @@ void domain_economy::change_commodity_input(const commodity *commodity, const ce
 	}
 
 	if (game::get()->is_running()) {
-		emit commodity_inputs_changed();
+		change_notifier::get()->notify(this, &domain_economy::commodity_inputs_changed);
 	}
 }
 
@@ -776,7 +801,7 @@ void domain_economy::change_commodity_output(const commodity *commodity, const c
 	}
 
 	if (game::get()->is_running()) {
-		emit commodity_outputs_changed();
+		change_notifier::get()->notify(this, &domain_economy::commodity_outputs_changed);
 	}
 }
 
@@ -932,7 +957,7 @@ void domain_economy::set_bid(const commodity *commodity, const int64_t value)
 	}
 
 	if (game::get()->is_running()) {
-		emit bids_changed();
+		change_notifier::get()->notify(this, &domain_economy::bids_changed);
 	}
 }
 
@@ -973,7 +998,7 @@ void domain_economy::set_offer(const commodity *commodity, const int64_t value)
 	}
 
 	if (game::get()->is_running()) {
-		emit offers_changed();
+		change_notifier::get()->notify(this, &domain_economy::offers_changed);
 	}
 }
 
@@ -1038,10 +1063,10 @@ void domain_economy::do_sale(const metternich::domain *other_domain, const commo
 		other_domain_economy->change_bid(commodity, -sold_quantity);
 	}
 
-	//improve relations between the two countries after they traded (even if it was not a state purchase)
+	//improve relations between the two countries after they traded (even if it was not a state purchase); the change is applied in bulk once the market has cleared
 	if (this->domain != other_domain) {
-		this->domain->get_diplomacy()->change_base_opinion(other_domain, 1);
-		other_domain_diplomacy->change_base_opinion(this->domain, 1);
+		this->domain->get_diplomacy()->add_pending_base_opinion_change(other_domain, 1);
+		other_domain_diplomacy->add_pending_base_opinion_change(this->domain, 1);
 	}
 }
 
@@ -1077,7 +1102,7 @@ void domain_economy::set_output_modifier(const centesimal_int &value)
 	this->calculate_site_commodity_outputs();
 
 	if (game::get()->is_running()) {
-		emit output_modifier_changed();
+		change_notifier::get()->notify(this, &domain_economy::output_modifier_changed);
 	}
 }
 
@@ -1122,7 +1147,7 @@ void domain_economy::set_throughput_modifier(const int value)
 	this->throughput_modifier = value;
 
 	if (game::get()->is_running()) {
-		emit throughput_modifier_changed();
+		change_notifier::get()->notify(this, &domain_economy::throughput_modifier_changed);
 	}
 }
 
@@ -100,17 +100,8 @@ public:
 
 	QVariantList get_available_commodities_qvariant_list() const;
 
-	void add_available_commodity(const commodity *commodity)
-	{
-		this->available_commodities.insert(commodity);
-		emit available_commodities_changed();
-	}
-
-	void remove_available_commodity(const commodity *commodity)
-	{
-		this->available_commodities.erase(commodity);
-		emit available_commodities_changed();
-	}
+	void add_available_commodity(const commodity *commodity);
+	void remove_available_commodity(const commodity *commodity);
 
 	const commodity_set &get_tradeable_commodities() const
 	{
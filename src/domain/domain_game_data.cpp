@@ -37,6 +37,7 @@
 #include "economy/income_transaction_type.h"
 #include "economy/resource.h"
 #include "engine_interface.h"
+#include "game/change_notifier.h"
 #include "game/domain_event.h"
 #include "game/event_trigger.h"
 #include "game/game.h"
@@ -210,15 +211,21 @@ void domain_game_data::process_gsml_scope(const gsml_data &scope)
 		}
 	} else if (tag == "active_journal_entries") {
 		for (const std::string &value : values) {
-			this->active_journal_entries.push_back(journal_entry::get(value));
+			const journal_entry *journal_entry = journal_entry::get(value);
+			this->active_journal_entries.push_back(journal_entry);
+			this->set_journal_entry_listed(journal_entry, true);
 		}
 	} else if (tag == "inactive_journal_entries") {
 		for (const std::string &value : values) {
-			this->inactive_journal_entries.push_back(journal_entry::get(value));
+			const journal_entry *journal_entry = journal_entry::get(value);
+			this->inactive_journal_entries.push_back(journal_entry);
+			this->set_journal_entry_listed(journal_entry, true);
 		}
 	} else if (tag == "finished_journal_entries") {
 		for (const std::string &value : values) {
-			this->finished_journal_entries.push_back(journal_entry::get(value));
+			const journal_entry *journal_entry = journal_entry::get(value);
+			this->finished_journal_entries.push_back(journal_entry);
+			this->set_journal_entry_listed(journal_entry, true);
 		}
 	} else if (tag == "diplomacy") {
 		scope.process(this->get_diplomacy());
@@ -787,10 +794,15 @@ QCoro::Task<void> domain_game_data::do_construction()
 	}
 
 	const int available_current_construction_slots = this->get_max_current_constructions() - under_construction_project_count;
-	for (int i = 0; i < available_current_construction_slots; ++i) {
-		const bool construction_chosen = co_await this->choose_construction();
-		if (construction_chosen) {
-			++under_construction_project_count;
+	if (available_current_construction_slots > 0) {
+		//gather the buildable locations once, and draw from them for each free construction slot
+		std::vector<std::variant<building_slot *, const province *>> buildable_locations = this->get_buildable_construction_locations();
+
+		for (int i = 0; i < available_current_construction_slots; ++i) {
+			const bool construction_chosen = co_await this->choose_construction(buildable_locations);
+			if (construction_chosen) {
+				++under_construction_project_count;
+			}
 		}
 	}
 
@@ -835,7 +847,7 @@ QCoro::Task<void> domain_game_data::do_population_promotion()
 QCoro::Task<void> domain_game_data::do_population_employment()
 {
 	for (const site *site : this->get_sites()) {
-		if (site->is_settlement() && site->get_game_data()->is_built()) {
+		if (site->is_settlement() && site->get_game_data()->is_built() && site->get_game_data()->needs_employment_check()) {
 			co_await site->get_game_data()->check_employment();
 		}
 	}
@@ -875,7 +887,7 @@ QCoro::Task<void> domain_game_data::do_events()
 
 bool domain_game_data::is_ai() const
 {
-	return this->domain != game::get()->get_player_domain();
+	return this->domain != game::get()->get_player_domain() || game::get()->is_player_ai_controlled();
 }
 
 domain_ai *domain_game_data::get_ai() const
@@ -2769,8 +2781,11 @@ QCoro::Task<void> domain_game_data::on_wonder_gained(const wonder *wonder, const
 	}
 }
 
-QCoro::Task<bool> domain_game_data::choose_construction()
+std::vector<std::variant<building_slot *, const province *>> domain_game_data::get_buildable_construction_locations() const
 {
+	//the scan doesn't change the game state, so building eligibility can be cached for its duration
+	const building_eligibility_cache_scope eligibility_cache_scope;
+
 	std::vector<std::variant<building_slot *, const province *>> buildable_locations;
 
 	for (const province *province : this->get_provinces()) {
@@ -2801,16 +2816,46 @@ QCoro::Task<bool> domain_game_data::choose_construction()
 		}
 	}
 
-	if (buildable_locations.empty()) {
-		co_return false;
-	}
+	return buildable_locations;
+}
 
+QCoro::Task<bool> domain_game_data::choose_construction(std::vector<std::variant<building_slot *, const province *>> &buildable_locations)
+{
 	vector::shuffle(buildable_locations);
+
+	//a previous choice in the same turn may have started construction in a location or spent the commodities needed for building in others, so revalidate candidates as they are drawn, dropping those which are no longer buildable
 	static constexpr size_t max_choosable_constructions = 5;
-	buildable_locations.resize(std::min(buildable_locations.size(), max_choosable_constructions));
+	std::vector<std::variant<building_slot *, const province *>> choosable_locations;
+
+	for (size_t i = 0; i < buildable_locations.size() && choosable_locations.size() < max_choosable_constructions;) {
+		const std::variant<building_slot *, const province *> &buildable_location = buildable_locations.at(i);
+
+		bool buildable = false;
+		if (std::holds_alternative<building_slot *>(buildable_location)) {
+			const building_slot *building_slot = std::get<metternich::building_slot *>(buildable_location);
+			buildable = building_slot->get_under_construction_building() == nullptr && building_slot->get_buildable_building() != nullptr;
+		} else if (std::holds_alternative<const province *>(buildable_location)) {
+			const province *province = std::get<const metternich::province *>(buildable_location);
+			buildable = province->get_game_data()->get_under_construction_pathway() == nullptr && province->get_game_data()->get_buildable_pathway() != nullptr;
+		} else {
+			assert_throw(false);
+		}
+
+		if (!buildable) {
+			buildable_locations.erase(buildable_locations.begin() + i);
+			continue;
+		}
+
+		choosable_locations.push_back(buildable_location);
+		++i;
+	}
+
+	if (choosable_locations.empty()) {
+		co_return false;
+	}
 
 	if (this->is_ai()) {
-		std::variant<building_slot *, const province *> chosen_buildable_location = vector::get_random(buildable_locations);
+		std::variant<building_slot *, const province *> chosen_buildable_location = vector::get_random(choosable_locations);
 		if (std::holds_alternative<building_slot *>(chosen_buildable_location)) {
 			building_slot *building_slot = std::get<metternich::building_slot *>(chosen_buildable_location);
 			building_slot->build_building(building_slot->get_buildable_building());
@@ -2825,12 +2870,25 @@ QCoro::Task<bool> domain_game_data::choose_construction()
 		const QFuture<void> future = this->construction_chosen_promise->future();
 		this->construction_chosen_promise->start();
 
-		emit engine_interface::get()->construction_choosable(container::to_qvariant_list(buildable_locations));
-		co_await future;
+		emit engine_interface::get()->construction_choosable(container::to_qvariant_list(choosable_locations));
+		{
+			//show the changes made so far in the turn while the player is choosing
+			const change_notification_pause notification_pause;
+			co_await future;
+		}
 	}
 
 	this->construction_chosen_promise.reset();
 
+	//the chosen location is now under construction
+	std::erase_if(buildable_locations, [](const std::variant<building_slot *, const province *> &buildable_location) {
+		if (std::holds_alternative<building_slot *>(buildable_location)) {
+			return std::get<building_slot *>(buildable_location)->get_under_construction_building() != nullptr;
+		}
+
+		return std::get<const province *>(buildable_location)->get_game_data()->get_under_construction_pathway() != nullptr;
+	});
+
 	co_return true;
 }
 
@@ -3306,44 +3364,49 @@ QCoro::Task<void> domain_game_data::check_characters()
 {
 	const QDate &current_date = game::get()->get_next_date();
 
+	//only characters whose start date has arrived and who are not part of any domain need to be checked, and of those only the ones homed in the domain's own sites
+	std::vector<const character *> available_characters;
 	for (const site *site : this->get_sites()) {
-		for (const character *site_character : site->get_game_data()->get_homed_characters()) {
-			if (site_character->get_game_data()->get_start_date() > current_date) {
-				continue;
-			}
+		vector::merge(available_characters, game::get()->get_available_homed_characters(site));
+	}
 
-			if (!site_character->is_immortal() && site_character->get_game_data()->get_death_date() <= current_date) {
-				continue;
-			}
+	for (const character *site_character : available_characters) {
+		const site *site = site_character->get_game_data()->get_home_site();
 
-			if (site_character->get_game_data()->is_dead()) {
-				continue;
-			}
+		if (!site_character->is_immortal() && site_character->get_game_data()->get_death_date() <= current_date) {
+			game::get()->remove_available_homed_character(site_character);
+			continue;
+		}
 
-			if (site_character->get_game_data()->get_domain() != nullptr) {
-				continue;
-			}
+		if (site_character->get_game_data()->is_dead()) {
+			game::get()->remove_available_homed_character(site_character);
+			continue;
+		}
 
-			const metternich::population *home_province_population = site->get_map_data()->get_province()->get_game_data()->get_population();
+		if (site_character->get_game_data()->get_domain() != nullptr) {
+			game::get()->remove_available_homed_character(site_character);
+			continue;
+		}
 
-			//the character's culture must be present in their home province's population
-			if (!home_province_population->get_culture_sizes().contains(site_character->get_culture())) {
-				continue;
-			}
+		const metternich::population *home_province_population = site->get_map_data()->get_province()->get_game_data()->get_population();
 
-			//the character's religion must be present in their home province's population
-			if (!home_province_population->get_religion_sizes().contains(site_character->get_religion())) {
-				continue;
-			}
+		//the character's culture must be present in their home province's population
+		if (!home_province_population->get_culture_sizes().contains(site_character->get_culture())) {
+			continue;
+		}
 
-			site_character->get_game_data()->set_domain(this->domain);
+		//the character's religion must be present in their home province's population
+		if (!home_province_population->get_religion_sizes().contains(site_character->get_religion())) {
+			continue;
+		}
 
-			if (this->domain == game::get()->get_player_domain()) {
-				engine_interface::get()->add_notification(std::format("{} Joined Us", site_character->get_game_data()->get_full_name()), site_character, std::format("{} has joined our domain!", site_character->get_game_data()->get_full_name()));
-			}
+		site_character->get_game_data()->set_domain(this->domain);
 
-			co_await on_character_recruited(site_character);
+		if (this->domain == game::get()->get_player_domain()) {
+			engine_interface::get()->add_notification(std::format("{} Joined Us", site_character->get_game_data()->get_full_name()), site_character, std::format("{} has joined our domain!", site_character->get_game_data()->get_full_name()));
 		}
+
+		co_await on_character_recruited(site_character);
 	}
 
 	for (const character *character : this->get_characters()) {
@@ -4181,6 +4244,29 @@ QVariantList domain_game_data::get_finished_journal_entries_qvariant_list() cons
 	return container::to_qvariant_list(this->get_finished_journal_entries());
 }
 
+bool domain_game_data::is_journal_entry_listed(const journal_entry *journal_entry) const
+{
+	const size_t index = static_cast<size_t>(journal_entry->get_index());
+	return index < this->listed_journal_entries.size() && this->listed_journal_entries[index];
+}
+
+void domain_game_data::set_journal_entry_listed(const journal_entry *journal_entry, const bool listed)
+{
+	assert_throw(journal_entry->get_index() != -1);
+
+	const size_t index = static_cast<size_t>(journal_entry->get_index());
+
+	if (index >= this->listed_journal_entries.size()) {
+		if (!listed) {
+			return;
+		}
+
+		this->listed_journal_entries.resize(journal_entry::get_all().size(), false);
+	}
+
+	this->listed_journal_entries[index] = listed;
+}
+
 QCoro::Task<void> domain_game_data::check_journal_entries(const bool ignore_effects, const bool ignore_random_chance)
 {
 	const read_only_context ctx(this->domain);
@@ -4210,15 +4296,7 @@ bool domain_game_data::check_potential_journal_entries()
 	bool changed = false;
 
 	for (const journal_entry *journal_entry : journal_entry::get_all()) {
-		if (vector::contains(this->get_active_journal_entries(), journal_entry)) {
-			continue;
-		}
-
-		if (vector::contains(this->get_inactive_journal_entries(), journal_entry)) {
-			continue;
-		}
-
-		if (vector::contains(this->get_finished_journal_entries(), journal_entry)) {
+		if (this->is_journal_entry_listed(journal_entry)) {
 			continue;
 		}
 
@@ -4227,6 +4305,7 @@ bool domain_game_data::check_potential_journal_entries()
 		}
 
 		this->inactive_journal_entries.push_back(journal_entry);
+		this->set_journal_entry_listed(journal_entry, true);
 		changed = true;
 	}
 
@@ -4242,6 +4321,7 @@ QCoro::Task<bool> domain_game_data::check_inactive_journal_entries()
 	for (const journal_entry *journal_entry : inactive_entries) {
 		if (!journal_entry->check_preconditions(this->domain)) {
 			std::erase(this->inactive_journal_entries, journal_entry);
+			this->set_journal_entry_listed(journal_entry, false);
 			changed = true;
 			continue;
 		}
@@ -4269,6 +4349,7 @@ QCoro::Task<bool> domain_game_data::check_active_journal_entries(const read_only
 	for (const journal_entry *journal_entry : active_entries) {
 		if (!journal_entry->check_preconditions(this->domain)) {
 			co_await this->remove_active_journal_entry(journal_entry);
+			this->set_journal_entry_listed(journal_entry, false);
 			changed = true;
 			continue;
 		}
@@ -44,6 +44,7 @@ namespace archimedes {
 namespace metternich {
 
 class building_item_slot;
+class building_slot;
 class building_type;
 class character;
 class civilian_unit;
@@ -670,7 +671,8 @@ public:
 
 	[[nodiscard]] QCoro::Task<void> on_wonder_gained(const wonder *wonder, const int multiplier);
 
-	[[nodiscard]] QCoro::Task<bool> choose_construction();
+	std::vector<std::variant<building_slot *, const province *>> get_buildable_construction_locations() const;
+	[[nodiscard]] QCoro::Task<bool> choose_construction(std::vector<std::variant<building_slot *, const province *>> &buildable_locations);
 
 	int get_max_current_constructions() const
 	{
@@ -1004,6 +1006,9 @@ public:
 	}
 
 	QVariantList get_finished_journal_entries_qvariant_list() const;
+
+	bool is_journal_entry_listed(const journal_entry *journal_entry) const;
+	void set_journal_entry_listed(const journal_entry *journal_entry, const bool listed);
 	[[nodiscard]] QCoro::Task<void> check_journal_entries(const bool ignore_effects = false, const bool ignore_random_chance = false);
 	bool check_potential_journal_entries();
 	[[nodiscard]] QCoro::Task<bool> check_inactive_journal_entries();
@@ -1169,6 +1174,7 @@ private:
 	std::vector<const journal_entry *> active_journal_entries;
 	std::vector<const journal_entry *> inactive_journal_entries;
 	std::vector<const journal_entry *> finished_journal_entries;
+	std::vector<bool> listed_journal_entries; //dense bitset over journal entry indices, marking the entries which are either active, inactive or finished
 	building_class_map<int> free_building_class_counts;
 	std::set<const flag *> flags;
 	std::unique_ptr<QPromise<void>> construction_chosen_promise;
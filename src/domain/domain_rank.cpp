@@ -6,6 +6,21 @@
 
 namespace metternich {
 
+void domain_rank::initialize_all()
+{
+	data_type::initialize_all();
+
+	domain_rank::ranks_by_priority.clear();
+	for (const domain_rank *rank : domain_rank::get_all()) {
+		domain_rank::ranks_by_priority.push_back(rank);
+	}
+
+	//stable sort so that ranks with the same priority keep their order, in which the earlier one is preferred
+	std::stable_sort(domain_rank::ranks_by_priority.begin(), domain_rank::ranks_by_priority.end(), [](const domain_rank *lhs, const domain_rank *rhs) {
+		return lhs->get_priority() > rhs->get_priority();
+	});
+}
+
 domain_rank::domain_rank(const std::string &identifier) : named_data_entry(identifier)
 {
 }
@@ -24,6 +24,23 @@ public:
 	static constexpr const char property_class_identifier[] = "metternich::domain_rank*";
 	static constexpr const char database_folder[] = "domain_ranks";
 
+	static void initialize_all();
+
+	static const std::vector<const domain_rank *> &get_all_by_priority()
+	{
+		return domain_rank::ranks_by_priority;
+	}
+
+	static void clear()
+	{
+		data_type::clear();
+		domain_rank::ranks_by_priority.clear();
+	}
+
+private:
+	static inline std::vector<const domain_rank *> ranks_by_priority; //sorted in descending order of priority
+
+public:
 	explicit domain_rank(const std::string &identifier);
 	~domain_rank();
 
@@ -13,6 +13,7 @@
 #include "economy/commodity.h"
 #include "economy/resource.h"
 #include "engine_interface.h"
+#include "game/change_notifier.h"
 #include "game/game.h"
 #include "map/map.h"
 #include "map/province.h"
@@ -364,11 +365,11 @@ QCoro::Task<void> domain_technology::add_technology(const technology *technology
 
 QCoro::Task<void> domain_technology::add_technology_with_prerequisites(const technology *technology)
 {
-	co_await this->add_technology(technology);
-
-	for (const metternich::technology *prerequisite : technology->get_prerequisites()) {
-		co_await this->add_technology_with_prerequisites(prerequisite);
+	for (const metternich::technology *prerequisite : technology->get_all_prerequisites()) {
+		co_await this->add_technology(prerequisite);
 	}
+
+	co_await this->add_technology(technology);
 }
 
 QCoro::Task<void> domain_technology::on_technology_added(const technology *technology)
@@ -727,7 +728,11 @@ QCoro::Task<void> domain_technology::choose_current_research()
 
 		const std::vector<const technology *> potential_technologies = archimedes::map::get_values(research_choice_map);
 		emit engine_interface::get()->technology_choosable(container::to_qvariant_list(potential_technologies));
-		co_await future;
+		{
+			//show the changes made so far in the turn while the player is choosing
+			const change_notification_pause notification_pause;
+			co_await future;
+		}
 	}
 }
 
@@ -786,6 +791,9 @@ QCoro::Task<void> domain_technology::on_technology_researched(const technology *
 
 data_entry_map<technology_category, const technology *> domain_technology::get_research_choice_map(const bool is_free) const
 {
+	//technology costs are calculated repeatedly while building the choices, and nothing changes in the meantime
+	const factor_memo_scope memo_scope;
+
 	const std::vector<const technology *> researchable_technologies = this->get_researchable_technologies();
 
 	if (researchable_technologies.empty()) {
@@ -855,7 +863,11 @@ QCoro::Task<void> domain_technology::gain_free_technology()
 
 		const std::vector<const technology *> potential_technologies = archimedes::map::get_values(research_choice_map);
 		emit engine_interface::get()->free_technology_choosable(container::to_qvariant_list(potential_technologies));
-		co_await future;
+		{
+			//show the changes made so far in the turn while the player is choosing
+			const change_notification_pause notification_pause;
+			co_await future;
+		}
 	}
 }
 
@@ -3,12 +3,29 @@
 #include "domain/domain_turn_data.h"
 
 #include "economy/expense_transaction.h"
+#include "economy/expense_transaction_type.h"
 #include "economy/income_transaction.h"
 #include "economy/income_transaction_type.h"
+#include "game/change_notifier.h"
 #include "util/container_util.h"
 
 namespace metternich {
 
+namespace {
+
+//the interface may still hold the transaction objects until it has processed the change signal and read the lists again, so they are deleted later rather than immediately
+template <typename transaction_type>
+void retire_transactions(std::vector<qunique_ptr<transaction_type>> &transactions)
+{
+	for (qunique_ptr<transaction_type> &transaction : transactions) {
+		transaction.release()->deleteLater();
+	}
+
+	transactions.clear();
+}
+
+}
+
 domain_turn_data::domain_turn_data(const metternich::domain *domain) : domain(domain)
 {
 }
@@ -17,63 +34,104 @@ domain_turn_data::~domain_turn_data()
 {
 }
 
+void domain_turn_data::reset()
+{
+	this->total_income = 0;
+	this->total_expense = 0;
+	this->income_ledger.reset();
+	this->expense_ledger.reset();
+	retire_transactions(this->income_transactions);
+	retire_transactions(this->expense_transactions);
+	this->income_transactions_dirty = true;
+	this->expense_transactions_dirty = true;
+	this->disbanded_military_units.clear();
+	this->province_spread_technologies.clear();
+	this->diplomatic_map_dirty = false;
+	this->realm_diplomatic_map_dirty = false;
+	this->dirty_diplomatic_map_modes.clear();
+	this->dirty_diplomatic_map_diplomacy_states.clear();
+
+	emit transactions_changed();
+}
+
 QVariantList domain_turn_data::get_income_transactions_qvariant_list() const
 {
+	if (this->income_transactions_dirty) {
+		retire_transactions(this->income_transactions);
+
+		for (const transaction_entry &entry : this->income_ledger.entries) {
+			if (entry.amount == 0 && entry.object_quantity == 0) {
+				continue;
+			}
+
+			this->income_transactions.push_back(make_qunique<income_transaction>(static_cast<income_transaction_type>(entry.key.type), entry.amount, entry.key.object, entry.object_quantity, entry.other_domain));
+		}
+
+		this->income_transactions_dirty = false;
+	}
+
 	return container::to_qvariant_list(this->income_transactions);
 }
 
 QVariantList domain_turn_data::get_expense_transactions_qvariant_list() const
 {
+	if (this->expense_transactions_dirty) {
+		retire_transactions(this->expense_transactions);
+
+		for (const transaction_entry &entry : this->expense_ledger.entries) {
+			if (entry.amount == 0 && entry.object_quantity == 0) {
+				continue;
+			}
+
+			this->expense_transactions.push_back(make_qunique<expense_transaction>(static_cast<expense_transaction_type>(entry.key.type), entry.amount, entry.key.object, entry.object_quantity, entry.other_domain));
+		}
+
+		this->expense_transactions_dirty = false;
+	}
+
 	return container::to_qvariant_list(this->expense_transactions);
 }
 
 void domain_turn_data::add_income_transaction(const income_transaction_type transaction_type, const int64_t amount, const transaction_object_variant &object, const int64_t object_quantity, const metternich::domain *other_domain)
 {
 	this->total_income += amount;
+	this->income_transactions_dirty = true;
 
-	for (const qunique_ptr<income_transaction> &transaction : this->income_transactions) {
-		if (transaction->get_type() != transaction_type) {
-			continue;
-		}
-
-		if (transaction->get_object() != object) {
-			continue;
-		}
-
-		transaction->change_amount(amount);
-		transaction->change_object_quantity(object_quantity);
-		return;
-	}
-
-	auto transaction = make_qunique<metternich::income_transaction>(transaction_type, amount, object, object_quantity, other_domain);
-	this->income_transactions.push_back(std::move(transaction));
+	transaction_entry &entry = this->income_ledger.get_entry(transaction_key{ static_cast<int>(transaction_type), object }, other_domain);
+	entry.amount += amount;
+	entry.object_quantity += object_quantity;
+	change_notifier::get()->notify(this, &domain_turn_data::transactions_changed);
 }
 
 void domain_turn_data::add_expense_transaction(const expense_transaction_type transaction_type, const int64_t amount, const transaction_object_variant &object, const int64_t object_quantity, const metternich::domain *other_domain)
 {
 	this->total_expense += amount;
+	this->expense_transactions_dirty = true;
 
-	for (const qunique_ptr<expense_transaction> &transaction : this->expense_transactions) {
-		if (transaction->get_type() != transaction_type) {
-			continue;
-		}
-
-		if (transaction->get_object() != object) {
-			continue;
-		}
-
-		transaction->change_amount(amount);
-		transaction->change_object_quantity(object_quantity);
+	transaction_entry &entry = this->expense_ledger.get_entry(transaction_key{ static_cast<int>(transaction_type), object }, other_domain);
+	entry.amount += amount;
+	entry.object_quantity += object_quantity;
+	change_notifier::get()->notify(this, &domain_turn_data::transactions_changed);
+}
 
-		if (transaction->get_amount() == 0 && transaction->get_object_quantity() == 0) {
-			std::erase(this->expense_transactions, transaction);
+domain_turn_data::transaction_entry &domain_turn_data::transaction_ledger::get_entry(const transaction_key &key, const metternich::domain *other_domain)
+{
+	const auto find_iterator = this->entry_indices.find(key);
+	if (find_iterator != this->entry_indices.end()) {
+		transaction_entry &entry = this->entries[find_iterator->second];
+		if (entry.amount == 0 && entry.object_quantity == 0) {
+			//the entry is unused in the current turn
+			entry.other_domain = other_domain;
 		}
-
-		return;
+		return entry;
 	}
 
-	auto transaction = make_qunique<metternich::expense_transaction>(transaction_type, amount, object, object_quantity, other_domain);
-	this->expense_transactions.push_back(std::move(transaction));
+	this->entry_indices[key] = this->entries.size();
+
+	transaction_entry &entry = this->entries.emplace_back();
+	entry.key = key;
+	entry.other_domain = other_domain;
+	return entry;
 }
 
 }
@@ -19,10 +19,10 @@ class domain_turn_data final : public QObject
 {
 	Q_OBJECT
 
-	Q_PROPERTY(qint64 total_income READ get_total_income CONSTANT)
-	Q_PROPERTY(qint64 total_expense READ get_total_expense CONSTANT)
-	Q_PROPERTY(QVariantList income_transactions READ get_income_transactions_qvariant_list CONSTANT)
-	Q_PROPERTY(QVariantList expense_transactions READ get_expense_transactions_qvariant_list CONSTANT)
+	Q_PROPERTY(qint64 total_income READ get_total_income NOTIFY transactions_changed)
+	Q_PROPERTY(qint64 total_expense READ get_total_expense NOTIFY transactions_changed)
+	Q_PROPERTY(QVariantList income_transactions READ get_income_transactions_qvariant_list NOTIFY transactions_changed)
+	Q_PROPERTY(QVariantList expense_transactions READ get_expense_transactions_qvariant_list NOTIFY transactions_changed)
 
 public:
 	using transaction_object_variant = std::variant<std::nullptr_t, const commodity *, const population_type *>;
@@ -30,6 +30,8 @@ public:
 	explicit domain_turn_data(const metternich::domain *domain);
 	~domain_turn_data();
 
+	void reset();
+
 	int64_t get_total_income() const
 	{
 		return this->total_income;
@@ -106,12 +108,64 @@ public:
 		this->dirty_diplomatic_map_diplomacy_states.insert(state);
 	}
 
+signals:
+	void transactions_changed();
+
 private:
+	struct transaction_key final
+	{
+		int type = 0;
+		transaction_object_variant object;
+
+		bool operator==(const transaction_key &other) const = default;
+	};
+
+	struct transaction_key_hash final
+	{
+		size_t operator()(const transaction_key &key) const
+		{
+			return std::hash<int>()(key.type) ^ (std::hash<transaction_object_variant>()(key.object) << 1);
+		}
+	};
+
+	struct transaction_entry final
+	{
+		transaction_key key;
+		int64_t amount = 0;
+		int64_t object_quantity = 0;
+		const metternich::domain *other_domain = nullptr;
+	};
+
+	//a flat ledger, in the order in which transactions were first added; entries are zeroed rather than removed when the turn data is reset, so that recording transactions no longer allocates once each kind of transaction has been seen
+	struct transaction_ledger final
+	{
+		transaction_entry &get_entry(const transaction_key &key, const metternich::domain *other_domain);
+
+		void reset()
+		{
+			for (transaction_entry &entry : this->entries) {
+				entry.amount = 0;
+				entry.object_quantity = 0;
+				entry.other_domain = nullptr;
+			}
+		}
+
+		std::vector<transaction_entry> entries;
+		std::unordered_map<transaction_key, size_t, transaction_key_hash> entry_indices;
+	};
+
 	const metternich::domain *domain = nullptr;
 	int64_t total_income = 0;
 	int64_t total_expense = 0;
-	std::vector<qunique_ptr<income_transaction>> income_transactions;
-	std::vector<qunique_ptr<expense_transaction>> expense_transactions;
+	transaction_ledger income_ledger;
+	transaction_ledger expense_ledger;
+
+	//transaction objects for the interface, created from the ledgers only when they are requested
+	mutable std::vector<qunique_ptr<income_transaction>> income_transactions;
+	mutable std::vector<qunique_ptr<expense_transaction>> expense_transactions;
+	mutable bool income_transactions_dirty = true;
+	mutable bool expense_transactions_dirty = true;
+
 	military_unit_type_map<int> disbanded_military_units;
 	province_map<std::vector<const technology *>> province_spread_technologies;
 	bool diplomatic_map_dirty = false;
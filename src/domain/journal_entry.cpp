@@ -31,6 +31,17 @@
 
 namespace metternich {
 
+void journal_entry::initialize_all()
+{
+	data_type::initialize_all();
+
+	int index = 0;
+	for (journal_entry *journal_entry : journal_entry::get_all()) {
+		journal_entry->index = index;
+		++index;
+	}
+}
+
 journal_entry::journal_entry(const std::string &identifier) : named_data_entry(identifier)
 {
 }
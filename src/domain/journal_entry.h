@@ -43,6 +43,8 @@ public:
 	static constexpr int ai_advisor_desire_modifier = 1000;
 	static constexpr int ai_leader_desire_modifier = 1000;
 
+	static void initialize_all();
+
 	explicit journal_entry(const std::string &identifier);
 	~journal_entry();
 
@@ -69,6 +71,11 @@ public:
 		return QString::fromStdString(this->get_description());
 	}
 
+	int get_index() const
+	{
+		return this->index;
+	}
+
 	bool check_preconditions(const domain *domain) const;
 	bool check_conditions(const domain *domain) const;
 	bool check_completion_conditions(const domain *domain, const bool ignore_random_chance) const;
@@ -143,6 +150,7 @@ signals:
 	void changed();
 
 private:
+	int index = -1; //dense index, used for per-domain journal entry bitsets
 	metternich::portrait *portrait = nullptr;
 	std::string description;
 	std::unique_ptr<const and_condition<domain>> preconditions;
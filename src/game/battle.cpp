@@ -254,7 +254,7 @@ QCoro::Task<void> battle::do_unit_round(military_unit *unit, std::vector<militar
 
 		QPoint target_pos(-1, -1);
 
-		if (army->get_domain() == game::get()->get_player_domain() && !this->is_autoplay_enabled()) {
+		if (army->get_domain() == game::get()->get_player_domain() && !this->is_autoplay_enabled() && !game::get()->is_player_ai_controlled()) {
 			emit movable_tiles_changed();
 
 			target_pos = co_await this->get_target();
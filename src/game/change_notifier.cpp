@@ -0,0 +1,124 @@
+#include "metternich.h"
+
+#include "game/change_notifier.h"
+
+#include "ui/text_cache.h"
+#include "util/assert_util.h"
+
+namespace metternich {
+
+namespace {
+
+//gives access to QObject::isSignalConnected, which is protected
+class signal_connection_checker final : public QObject
+{
+public:
+	static bool is_signal_connected(const QObject *object, const QMetaMethod &signal)
+	{
+		return (object->*(&signal_connection_checker::isSignalConnected))(signal);
+	}
+};
+
+}
+
+void change_notifier::notify(QObject *object, const QMetaMethod &signal)
+{
+	assert_throw(object != nullptr);
+	assert_throw(signal.isValid());
+
+	//any notified change can affect generated interface texts, even if nothing is connected to the signal
+	text_cache::get()->invalidate();
+
+	if (!signal_connection_checker::is_signal_connected(object, signal)) {
+		return;
+	}
+
+	if (!this->is_in_phase()) {
+		signal.invoke(object, Qt::DirectConnection);
+		return;
+	}
+
+	const std::pair<const QObject *, int> key(object, signal.methodIndex());
+	const auto find_iterator = this->queued_notification_indices.find(key);
+	if (find_iterator != this->queued_notification_indices.end()) {
+		std::pair<QPointer<QObject>, QMetaMethod> &queued_notification = this->queued_notifications.at(find_iterator->second);
+
+		//if the queued object was destroyed, this is a different object which was created at the same address
+		if (queued_notification.first == nullptr) {
+			queued_notification.first = object;
+		}
+
+		return;
+	}
+
+	this->queued_notification_indices.emplace(key, this->queued_notifications.size());
+	this->queued_notifications.emplace_back(object, signal);
+}
+
+void change_notifier::begin_phase()
+{
+	++this->phase_depth;
+}
+
+void change_notifier::end_phase()
+{
+	assert_throw(this->phase_depth > 0);
+
+	--this->phase_depth;
+
+	if (this->is_in_phase()) {
+		return;
+	}
+
+	this->emit_queued_notifications();
+}
+
+void change_notifier::discard_phase()
+{
+	assert_throw(this->phase_depth > 0);
+
+	--this->phase_depth;
+
+	if (this->is_in_phase()) {
+		return;
+	}
+
+	this->queued_notifications.clear();
+	this->queued_notification_indices.clear();
+}
+
+int change_notifier::pause()
+{
+	const int paused_phase_depth = this->phase_depth;
+	this->phase_depth = 0;
+
+	//the state may have been changed by setters which emit their signals directly, and the player can now see texts describing it
+	text_cache::get()->invalidate();
+
+	this->emit_queued_notifications();
+
+	return paused_phase_depth;
+}
+
+void change_notifier::resume(const int phase_depth)
+{
+	this->phase_depth = phase_depth;
+}
+
+void change_notifier::emit_queued_notifications()
+{
+	const std::vector<std::pair<QPointer<QObject>, QMetaMethod>> notifications = std::move(this->queued_notifications);
+	this->queued_notifications.clear();
+	this->queued_notification_indices.clear();
+
+	for (const auto &[object, signal] : notifications) {
+		//the object may have been destroyed during the phase
+		if (object == nullptr) {
+			continue;
+		}
+
+		signal.invoke(object.data(), Qt::DirectConnection);
+	}
+}
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "util/assert_util.h"
+#include "util/singleton.h"
+
+#pragma warning(push, 0)
+#include <QMetaMethod>
+#include <QPointer>
+#pragma warning(pop)
+
+namespace metternich {
+
+//coalesces the parameterless change signals of game data objects: while a turn phase is being processed, each signal is only recorded, and is emitted once when the phase ends; signals without connected receivers, such as those of AI domains not shown in the interface, are not emitted at all
+class change_notifier final : public singleton<change_notifier>
+{
+public:
+	template <typename object_type, typename signal_type>
+	void notify(object_type *object, const signal_type signal)
+	{
+		this->notify(static_cast<QObject *>(object), QMetaMethod::fromSignal(signal));
+	}
+
+	void notify(QObject *object, const QMetaMethod &signal);
+
+	bool is_in_phase() const
+	{
+		return this->phase_depth > 0;
+	}
+
+	void begin_phase();
+	void end_phase();
+
+	//ends a phase without emitting the recorded signals, used when the phase is left because of an exception
+	void discard_phase();
+
+	//emits the recorded signals and stops recording until resumed, returning the phase depth to resume with
+	int pause();
+	void resume(const int phase_depth);
+
+private:
+	void emit_queued_notifications();
+
+private:
+	int phase_depth = 0;
+	std::vector<std::pair<QPointer<QObject>, QMetaMethod>> queued_notifications;
+
+	//the index in the queued notifications for each object and signal index; the object pointer may belong to an object which has since been destroyed, in which case the queued notification's pointer is null
+	std::map<std::pair<const QObject *, int>, size_t> queued_notification_indices;
+};
+
+//records change signals for the duration of its scope; the signals are emitted when end() is called, and discarded if the scope is left without calling it, e.g. because of an exception
+class change_notification_phase final
+{
+public:
+	change_notification_phase()
+	{
+		change_notifier::get()->begin_phase();
+	}
+
+	~change_notification_phase()
+	{
+		if (!this->ended) {
+			change_notifier::get()->discard_phase();
+		}
+	}
+
+	change_notification_phase(const change_notification_phase &other) = delete;
+	change_notification_phase &operator =(const change_notification_phase &other) = delete;
+
+	void end()
+	{
+		assert_throw(!this->ended);
+
+		this->ended = true;
+		change_notifier::get()->end_phase();
+	}
+
+private:
+	bool ended = false;
+};
+
+//emits the recorded change signals and stops recording for the duration of its scope, so that the interface is up to date while e.g. waiting for the player to make a choice in the middle of a turn
+class change_notification_pause final
+{
+public:
+	change_notification_pause() : phase_depth(change_notifier::get()->pause())
+	{
+	}
+
+	~change_notification_pause()
+	{
+		change_notifier::get()->resume(this->phase_depth);
+	}
+
+	change_notification_pause(const change_notification_pause &other) = delete;
+	change_notification_pause &operator =(const change_notification_pause &other) = delete;
+
+private:
+	int phase_depth = 0;
+};
+
+}
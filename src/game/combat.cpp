@@ -387,7 +387,7 @@ QCoro::Task<int64_t> combat::do_character_round(const character *character, part
 
 		QPoint target_pos(-1, -1);
 
-		if (party->get_domain() == game::get()->get_player_domain() && !this->is_autoplay_enabled()) {
+		if (party->get_domain() == game::get()->get_player_domain() && !this->is_autoplay_enabled() && !game::get()->is_player_ai_controlled()) {
 			emit movable_tiles_changed();
 
 			target_pos = co_await this->get_target();
@@ -5,6 +5,7 @@
 #include "game/decision_type.h"
 #include "script/condition/and_condition.h"
 #include "script/effect/effect_list.h"
+#include "ui/text_cache.h"
 
 namespace metternich {
 
@@ -60,9 +61,11 @@ QString decision::get_conditions_string(const domain *domain) const
 
 QString decision::get_effects_string(const domain *domain) const
 {
-	std::string str = this->get_effects()->get_effects_single_line_string(domain, read_only_context(domain));
+	return text_cache::get()->get(this, domain, 0, [this, domain]() {
+		const std::string str = this->get_effects()->get_effects_single_line_string(domain, read_only_context(domain));
 
-	return QString::fromStdString(str);
+		return QString::fromStdString(str);
+	});
 }
 
 bool decision::can_be_enacted_by(const metternich::domain *domain) const
@@ -78,6 +81,8 @@ QCoro::Task<void> decision::enact_for_coro(const metternich::domain *domain) con
 {
 	context ctx(domain);
 	co_await this->get_effects()->do_effects(domain, ctx);
+
+	text_cache::get()->invalidate();
 }
 
 }
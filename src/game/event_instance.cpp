@@ -7,6 +7,7 @@
 #include "game/event_option.h"
 #include "game/game.h"
 #include "script/context.h"
+#include "ui/text_cache.h"
 #include "util/assert_util.h"
 #include "util/exception_util.h"
 
@@ -40,6 +41,8 @@ QCoro::Task<void> event_instance::choose_option_coro(const int displayed_option_
 			co_await this->event->do_option_effects(option_index, this->ctx);
 		}
 
+		text_cache::get()->invalidate();
+
 		emit finished();
 
 		engine_interface::get()->remove_event_instance(this);
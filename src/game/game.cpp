@@ -31,6 +31,7 @@
 #include "domain/office.h"
 #include "economy/commodity.h"
 #include "engine_interface.h"
+#include "game/change_notifier.h"
 #include "game/character_event.h"
 #include "game/combat_base.h"
 #include "game/domain_event.h"
@@ -70,7 +71,9 @@
 #include "script/effect/delayed_effect_instance.h"
 #include "technology/technology.h"
 #include "time/calendar.h"
+#include "ui/image_scaling.h"
 #include "ui/portrait.h"
+#include "ui/text_cache.h"
 #include "unit/army.h"
 #include "unit/civilian_unit_type.h"
 #include "unit/historical_civilian_unit.h"
@@ -97,8 +100,6 @@
 #include "util/vector_random_util.h"
 #include "util/vector_util.h"
 
-#include "xbrz.h"
-
 namespace metternich {
 
 QDate game::normalize_date(const QDate &date)
@@ -464,6 +465,7 @@ QCoro::Task<void> game::start_coro()
 		}
 
 		map::get()->create_minimap_image();
+		map::get()->create_map_block_index();
 
 		co_await this->create_exploration_diplomatic_map_image();
 
@@ -511,7 +513,13 @@ QCoro::Task<void> game::start_coro()
 
 		engine_interface::get()->reset_active_civilian_units();
 
+		text_cache::get()->invalidate();
+
 		this->set_running(true);
+
+		if (this->get_player_domain() != nullptr) {
+			technology::precompute_effects_strings(this->get_player_domain());
+		}
 	} catch (...) {
 		exception::report(std::current_exception());
 		log::log_error("Failed to start game.");
@@ -528,6 +536,7 @@ QCoro::Task<void> game::stop_coro()
 		}
 
 		this->set_running(false);
+		text_cache::get()->invalidate();
 		co_await this->clear_coro();
 		map::get()->clear();
 		this->set_player_character(nullptr);
@@ -586,6 +595,9 @@ QCoro::Task<void> game::reset_game_data()
 	}
 
 	this->generated_characters.clear();
+	this->character_activations.clear();
+	this->available_homed_characters.clear();
+	this->available_homed_character_sites.clear();
 }
 
 QCoro::Task<void> game::initialize()
@@ -1950,31 +1962,40 @@ QCoro::Task<void> game::do_turn_coro()
 		domain_map<commodity_map<int64_t>> old_bids;
 		domain_map<commodity_map<int64_t>> old_offers;
 
-		for (province *province : map::get()->get_provinces()) {
-			province->reset_turn_data();
-		}
+		{
+			//coalesce change signals while the turn is being simulated, emitting them once before events are shown to the player
+			change_notification_phase notification_phase;
 
-		for (domain *domain : this->get_domains()) {
-			domain->reset_turn_data();
+			for (province *province : map::get()->get_provinces()) {
+				province->reset_turn_data();
+			}
+
+			for (domain *domain : this->get_domains()) {
+				domain->reset_turn_data();
 
-			domain->get_economy()->calculate_commodity_needs();
+				domain->get_economy()->calculate_commodity_needs();
+
+				if (domain->get_game_data()->is_ai()) {
+					co_await domain->get_ai()->do_turn();
+				}
 
-			if (domain->get_game_data()->is_ai()) {
-				co_await domain->get_ai()->do_turn();
+				old_bids[domain] = domain->get_economy()->get_bids();
+				old_offers[domain] = domain->get_economy()->get_offers();
 			}
 
-			old_bids[domain] = domain->get_economy()->get_bids();
-			old_offers[domain] = domain->get_economy()->get_offers();
-		}
+			this->process_character_activations(this->get_next_date());
 
-		for (const domain *domain : this->get_domains()) {
-			co_await domain->get_game_data()->do_turn();
+			for (const domain *domain : this->get_domains()) {
+				co_await domain->get_game_data()->do_turn();
 
-			domain->get_economy()->prepare_bids();
-			domain->get_economy()->prepare_offers();
-		}
+				domain->get_economy()->prepare_bids();
+				domain->get_economy()->prepare_offers();
+			}
+
+			this->do_trade();
 
-		this->do_trade();
+			notification_phase.end();
+		}
 
 		for (const domain *domain : this->get_domains()) {
 			//do country events after processing the turn for each country, so that e.g. events won't refer to a scope which no longer exists by the time the player gets to choose an option
@@ -2075,6 +2096,11 @@ void game::do_trade()
 		domain->get_economy()->do_trade();
 	}
 
+	//apply the opinion changes from trade in bulk, so that they don't affect trade priorities while the market is still clearing
+	for (const domain *domain : this->get_domains()) {
+		domain->get_diplomacy()->apply_pending_base_opinion_changes();
+	}
+
 	//change commodity prices based on whether there were unfulfilled bids/offers
 	commodity_map<int64_t> remaining_demands;
 	for (const domain *domain : trade_domains) {
@@ -2136,7 +2162,13 @@ void game::increment_turn()
 
 	++this->turn;
 
+	text_cache::get()->invalidate();
+
 	emit turn_changed();
+
+	if (this->get_player_domain() != nullptr) {
+		technology::precompute_effects_strings(this->get_player_domain());
+	}
 }
 
 std::string game::get_date_string() const
@@ -2260,9 +2292,15 @@ void game::calculate_domain_ranks()
 	average_score /= domains.size();
 
 	for (const domain *domain : domains) {
+		const centesimal_int score(domain->get_game_data()->get_score());
+
+		//go through the ranks from the highest priority downwards, so that the first matching rank is the best one
 		const domain_rank *best_rank = nullptr;
-		for (const domain_rank *rank : domain_rank::get_all()) {
-			if (best_rank != nullptr && best_rank->get_priority() >= rank->get_priority()) {
+		for (const domain_rank *rank : domain_rank::get_all_by_priority()) {
+			//check the score thresholds first, since they are much cheaper to check than the conditions
+			const centesimal_int average_score_threshold = rank->get_average_score_threshold() * average_score;
+			const centesimal_int relative_score_threshold = rank->get_relative_score_threshold() * highest_score;
+			if (score < average_score_threshold && score < relative_score_threshold) {
 				continue;
 			}
 
@@ -2270,12 +2308,8 @@ void game::calculate_domain_ranks()
 				continue;
 			}
 
-			const centesimal_int score(domain->get_game_data()->get_score());
-			const centesimal_int average_score_threshold = rank->get_average_score_threshold() * average_score;
-			const centesimal_int relative_score_threshold = rank->get_relative_score_threshold() * highest_score;
-			if (score >= average_score_threshold || score >= relative_score_threshold) {
-				best_rank = rank;
-			}
+			best_rank = rank;
+			break;
 		}
 
 		if (best_rank != nullptr) {
@@ -2347,6 +2381,11 @@ QCoro::Task<void> game::create_diplomatic_map_image()
 	tasks.push_back(map::get()->create_empty_diplomatic_map_image());
 	tasks.push_back(map::get()->create_empty_terrain_diplomatic_map_image());
 
+	//the province raster is shared by all domains, so it is created before their images are composed concurrently
+	if (map::get()->get_diplomatic_map_province_raster().empty()) {
+		map::get()->create_diplomatic_map_province_raster();
+	}
+
 	std::vector<QFuture<void>> futures;
 	for (const domain *domain : this->get_domains()) {
 		QFuture<void> future = QtConcurrent::run([domain]() {
@@ -2408,9 +2447,7 @@ QCoro::Task<void> game::create_exploration_diplomatic_map_image()
 		QImage scaled_exploration_diplomatic_map_image;
 
 		co_await QtConcurrent::run([this, tile_scale, &scaled_exploration_diplomatic_map_image]() {
-			scaled_exploration_diplomatic_map_image = image::scale<QImage::Format_ARGB32>(this->exploration_diplomatic_map_image, centesimal_int(tile_scale), [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-				xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-			});
+			scaled_exploration_diplomatic_map_image = image_scaling::scale(this->exploration_diplomatic_map_image, centesimal_int(tile_scale));
 		});
 
 		this->exploration_diplomatic_map_image = std::move(scaled_exploration_diplomatic_map_image);
@@ -2474,10 +2511,76 @@ void game::add_generated_character(qunique_ptr<character> &&character)
 
 void game::remove_generated_character(character *character)
 {
+	std::erase_if(this->character_activations, [character](const auto &element) {
+		return element.second == character;
+	});
+	this->remove_available_homed_character(character);
+
 	this->generated_characters_by_identifier.erase(character->get_identifier());
 	vector::remove(this->generated_characters, character);
 }
 
+void game::add_homed_character(const character *character)
+{
+	this->character_activations.emplace(character->get_game_data()->get_start_date(), character);
+}
+
+void game::process_character_activations(const QDate &date)
+{
+	//only the characters whose start date has arrived need to be processed, instead of checking every homed character each turn
+	while (!this->character_activations.empty() && this->character_activations.begin()->first <= date) {
+		const character *character = this->character_activations.begin()->second;
+		this->character_activations.erase(this->character_activations.begin());
+
+		const character_game_data *character_game_data = character->get_game_data();
+
+		if (character_game_data->is_dead()) {
+			continue;
+		}
+
+		if (!character->is_immortal() && character_game_data->get_death_date() <= date) {
+			continue;
+		}
+
+		if (character_game_data->get_domain() != nullptr) {
+			continue;
+		}
+
+		this->add_available_homed_character(character);
+	}
+}
+
+void game::add_available_homed_character(const character *character)
+{
+	const site *home_site = character->get_game_data()->get_home_site();
+	assert_throw(home_site != nullptr);
+
+	const auto [iterator, inserted] = this->available_homed_character_sites.emplace(character, home_site);
+	if (!inserted) {
+		return;
+	}
+
+	this->available_homed_characters[home_site].push_back(character);
+}
+
+void game::remove_available_homed_character(const character *character)
+{
+	const auto find_iterator = this->available_homed_character_sites.find(character);
+	if (find_iterator == this->available_homed_character_sites.end()) {
+		return;
+	}
+
+	const site *home_site = find_iterator->second;
+	this->available_homed_character_sites.erase(find_iterator);
+
+	std::vector<const metternich::character *> &site_characters = this->available_homed_characters.find(home_site)->second;
+	std::erase(site_characters, character);
+
+	if (site_characters.empty()) {
+		this->available_homed_characters.erase(home_site);
+	}
+}
+
 QCoro::Task<void> game::process_delayed_effects()
 {
 	co_await this->process_delayed_effects(this->character_delayed_effects);
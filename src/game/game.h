@@ -236,6 +236,16 @@ public:
 
 	void set_player_domain(const domain *domain);
 
+	bool is_player_ai_controlled() const
+	{
+		return this->player_ai_controlled;
+	}
+
+	void set_player_ai_controlled(const bool ai_controlled)
+	{
+		this->player_ai_controlled = ai_controlled;
+	}
+
 	Q_INVOKABLE qint64 get_price(const metternich::commodity *commodity) const;
 	void set_price(const commodity *commodity, const int64_t value);
 
@@ -295,6 +305,24 @@ public:
 	void add_generated_character(qunique_ptr<character> &&character);
 	void remove_generated_character(character *character);
 
+	void add_homed_character(const character *character);
+	void process_character_activations(const QDate &date);
+
+	const std::vector<const character *> &get_available_homed_characters(const site *home_site) const
+	{
+		static const std::vector<const character *> empty_vector;
+
+		const auto find_iterator = this->available_homed_characters.find(home_site);
+		if (find_iterator != this->available_homed_characters.end()) {
+			return find_iterator->second;
+		}
+
+		return empty_vector;
+	}
+
+	void add_available_homed_character(const character *character);
+	void remove_available_homed_character(const character *character);
+
 	[[nodiscard]] QCoro::Task<void> process_delayed_effects();
 
 private:
@@ -369,12 +397,16 @@ private:
 	std::vector<domain *> countries; //the domains which have at least 1 province
 	const character *player_character = nullptr;
 	const domain *player_domain = nullptr;
+	bool player_ai_controlled = false; //whether the player's domain and character are controlled by the AI, e.g. when running headless
 	commodity_map<int64_t> prices;
 	QImage exploration_diplomatic_map_image;
 	bool exploration_changed = false;
 	std::map<const wonder *, const domain *> wonder_countries;
 	std::vector<qunique_ptr<character>> generated_characters;
 	std::map<std::string, character *> generated_characters_by_identifier;
+	std::multimap<QDate, const character *> character_activations; //homed characters which have not become available yet, keyed by their start date
+	std::map<const site *, std::vector<const character *>> available_homed_characters; //homed characters whose start date has arrived, and who do not belong to any domain, per home site, so that each domain only checks the characters homed in its own sites
+	std::map<const character *, const site *> available_homed_character_sites; //the home site under which each available homed character is listed
 	std::vector<std::unique_ptr<delayed_effect_instance<const character>>> character_delayed_effects;
 	std::vector<std::unique_ptr<delayed_effect_instance<const domain>>> country_delayed_effects;
 	std::vector<std::unique_ptr<delayed_effect_instance<const province>>> province_delayed_effects;
@@ -0,0 +1,271 @@
+#include "metternich.h"
+
+#include "game/game_state_hash.h"
+
+#include "character/character.h"
+#include "character/character_attribute.h"
+#include "character/character_game_data.h"
+#include "character/trait.h"
+#include "culture/culture.h"
+#include "domain/domain.h"
+#include "domain/domain_diplomacy.h"
+#include "domain/domain_economy.h"
+#include "domain/domain_game_data.h"
+#include "domain/domain_government.h"
+#include "domain/domain_military.h"
+#include "domain/domain_technology.h"
+#include "domain/government_type.h"
+#include "domain/journal_entry.h"
+#include "domain/law.h"
+#include "domain/law_group.h"
+#include "economy/commodity.h"
+#include "game/game.h"
+#include "infrastructure/building_slot.h"
+#include "infrastructure/building_type.h"
+#include "infrastructure/holding_type.h"
+#include "map/map.h"
+#include "map/province.h"
+#include "map/province_game_data.h"
+#include "map/site.h"
+#include "map/site_game_data.h"
+#include "population/population_type.h"
+#include "population/population_unit.h"
+#include "religion/religion.h"
+#include "script/opinion_modifier.h"
+#include "technology/technology.h"
+#include "unit/army.h"
+#include "unit/military_unit.h"
+#include "unit/military_unit_type.h"
+#include "unit/promotion.h"
+#include "util/random.h"
+
+#pragma warning(push, 0)
+#include <QCryptographicHash>
+#pragma warning(pop)
+
+namespace metternich::game_state_hash {
+
+class state_hasher final
+{
+public:
+	template <typename T> requires (std::is_arithmetic_v<T>)
+	void add(const T value)
+	{
+		this->hash.addData(QByteArrayView(reinterpret_cast<const char *>(&value), sizeof(value)));
+	}
+
+	void add(const std::string &str)
+	{
+		this->add(str.size());
+		this->hash.addData(QByteArrayView(str.data(), static_cast<qsizetype>(str.size())));
+	}
+
+	//adds the identifier of a data entry, or an empty string if it is null
+	template <typename T>
+	void add_entry(const T *entry)
+	{
+		if (entry != nullptr) {
+			this->add(entry->get_identifier());
+		} else {
+			this->add(std::string());
+		}
+	}
+
+	QByteArray get_result() const
+	{
+		return this->hash.result().toHex();
+	}
+
+private:
+	QCryptographicHash hash = QCryptographicHash(QCryptographicHash::Sha1);
+};
+
+static void add_domain(state_hasher &hasher, const domain *domain)
+{
+	const domain_game_data *domain_game_data = domain->get_game_data();
+	const domain_economy *domain_economy = domain->get_economy();
+
+	hasher.add_entry(domain);
+	hasher.add(domain_game_data->get_score());
+	hasher.add(domain_game_data->get_economic_score());
+	hasher.add(domain_game_data->get_military_score());
+	hasher.add(domain_game_data->get_province_count());
+	hasher.add_entry(domain->get_diplomacy()->get_overlord());
+	hasher.add(domain_economy->get_wealth());
+
+	for (const auto &[commodity, quantity] : domain_economy->get_stored_commodities()) {
+		hasher.add_entry(commodity);
+		hasher.add(quantity);
+	}
+
+	for (const technology *technology : domain->get_technology()->get_technologies()) {
+		hasher.add_entry(technology);
+	}
+
+	hasher.add_entry(domain_game_data->get_government_type());
+
+	for (const auto &[law_group, law] : domain->get_government()->get_laws()) {
+		hasher.add_entry(law_group);
+		hasher.add_entry(law);
+	}
+
+	for (const auto &[other_domain, state] : domain->get_diplomacy()->get_diplomacy_states()) {
+		hasher.add_entry(other_domain);
+		hasher.add(static_cast<int>(state));
+	}
+
+	for (const auto &[other_domain, opinion] : domain->get_diplomacy()->get_base_opinions()) {
+		hasher.add_entry(other_domain);
+		hasher.add(opinion);
+	}
+
+	for (const auto &[other_domain, opinion_modifiers] : domain->get_diplomacy()->get_opinion_modifiers()) {
+		hasher.add_entry(other_domain);
+
+		for (const auto &[opinion_modifier, duration] : opinion_modifiers) {
+			hasher.add_entry(opinion_modifier);
+			hasher.add(duration);
+		}
+	}
+
+	hasher.add(std::string("active"));
+	for (const journal_entry *journal_entry : domain_game_data->get_active_journal_entries()) {
+		hasher.add_entry(journal_entry);
+	}
+
+	hasher.add(std::string("inactive"));
+	for (const journal_entry *journal_entry : domain_game_data->get_inactive_journal_entries()) {
+		hasher.add_entry(journal_entry);
+	}
+
+	hasher.add(std::string("finished"));
+	for (const journal_entry *journal_entry : domain_game_data->get_finished_journal_entries()) {
+		hasher.add_entry(journal_entry);
+	}
+
+	for (const qunique_ptr<military_unit> &military_unit : domain->get_military()->get_military_units()) {
+		hasher.add(military_unit->get_name());
+		hasher.add_entry(military_unit->get_type());
+		hasher.add_entry(military_unit->get_province());
+		hasher.add(military_unit->get_hit_points());
+
+		for (const promotion *promotion : military_unit->get_promotions()) {
+			hasher.add_entry(promotion);
+		}
+	}
+
+	for (const qunique_ptr<army> &army : domain->get_military()->get_armies()) {
+		hasher.add_entry(army->get_target_province());
+
+		for (const military_unit *military_unit : army->get_military_units()) {
+			hasher.add(military_unit->get_name());
+		}
+	}
+}
+
+static void add_province(state_hasher &hasher, const province *province)
+{
+	const province_game_data *province_game_data = province->get_game_data();
+
+	hasher.add_entry(province);
+	hasher.add_entry(province_game_data->get_owner());
+	hasher.add_entry(province_game_data->get_culture());
+	hasher.add_entry(province_game_data->get_religion());
+
+	for (const technology *technology : province_game_data->get_technologies()) {
+		hasher.add_entry(technology);
+	}
+}
+
+static void add_site(state_hasher &hasher, const site *site)
+{
+	const site_game_data *site_game_data = site->get_game_data();
+
+	hasher.add_entry(site);
+	hasher.add_entry(site_game_data->get_owner());
+	hasher.add_entry(site_game_data->get_holding_type());
+	hasher.add_entry(site_game_data->get_culture());
+	hasher.add_entry(site_game_data->get_religion());
+
+	for (const qunique_ptr<building_slot> &building_slot : site_game_data->get_building_slots()) {
+		hasher.add_entry(building_slot->get_building());
+	}
+
+	for (const qunique_ptr<population_unit> &population_unit : site_game_data->get_population_units()) {
+		hasher.add_entry(population_unit->get_type());
+		hasher.add_entry(population_unit->get_culture());
+		hasher.add_entry(population_unit->get_religion());
+		hasher.add(population_unit->get_size());
+		hasher.add(population_unit->get_wealth());
+	}
+
+	for (const auto &[commodity, output] : site_game_data->get_commodity_outputs()) {
+		hasher.add_entry(commodity);
+		hasher.add(output.to_string());
+	}
+}
+
+static void add_character(state_hasher &hasher, const character *character)
+{
+	const character_game_data *character_game_data = character->get_game_data();
+
+	hasher.add_entry(character);
+	hasher.add(character_game_data->is_dead());
+	hasher.add_entry(character_game_data->get_domain());
+	hasher.add(character_game_data->get_experience());
+
+	for (const character_attribute *attribute : character_attribute::get_all()) {
+		hasher.add(character_game_data->get_attribute_value(attribute));
+	}
+
+	for (const auto &[trait, count] : character_game_data->get_trait_counts()) {
+		hasher.add_entry(trait);
+		hasher.add(count);
+	}
+}
+
+QByteArray calculate()
+{
+	state_hasher hasher;
+
+	hasher.add(game::get()->get_turn());
+	hasher.add(game::get()->get_date().toJulianDay());
+	hasher.add(calculate_random_state().toStdString());
+
+	for (const commodity *commodity : commodity::get_all()) {
+		hasher.add_entry(commodity);
+		hasher.add(game::get()->get_price(commodity));
+	}
+
+	for (const domain *domain : game::get()->get_domains()) {
+		add_domain(hasher, domain);
+	}
+
+	for (const province *province : map::get()->get_provinces()) {
+		add_province(hasher, province);
+	}
+
+	for (const site *site : map::get()->get_sites()) {
+		add_site(hasher, site);
+	}
+
+	for (const character *character : character::get_all()) {
+		add_character(hasher, character);
+	}
+
+	for (const qunique_ptr<character> &character : game::get()->get_generated_characters()) {
+		add_character(hasher, character.get());
+	}
+
+	return hasher.get_result();
+}
+
+QByteArray calculate_random_state()
+{
+	std::ostringstream stream;
+	stream << random::get()->get_engine();
+
+	return QCryptographicHash::hash(QByteArray::fromStdString(stream.str()), QCryptographicHash::Sha1).toHex();
+}
+
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace metternich::game_state_hash {
+
+//calculates a canonical hash of the simulation state, used to verify that runs are deterministic
+//it covers the turn, date, random state and commodity prices; for domains, their scores, wealth, stored commodities, technologies, government type, laws, diplomacy states, opinions, opinion modifiers, journal entries, military units and armies; for provinces, their owner, culture, religion and technologies; for sites, their owner, holding type, culture, religion, buildings, population units and commodity outputs; and for characters, whether they are dead, their domain, experience, attributes and traits
+[[nodiscard]]
+extern QByteArray calculate();
+
+//calculates a hash of the random number generator's state
+[[nodiscard]]
+extern QByteArray calculate_random_state();
+
+}
@@ -109,6 +109,11 @@ public:
 		return QString::fromStdString(this->get_description());
 	}
 
+	const std::vector<const domain *> &get_default_domains() const
+	{
+		return this->default_domains;
+	}
+
 	QVariantList get_default_domains_qvariant_list() const;
 
 signals:
@@ -5,6 +5,7 @@
 #include "database/gsml_data.h"
 #include "domain/domain.h"
 #include "domain/domain_turn_data.h"
+#include "game/change_notifier.h"
 #include "game/event.h"
 #include "game/event_instance.h"
 #include "game/event_option.h"
@@ -50,6 +51,10 @@ const scope_type *scoped_event_base<scope_type>::get_scope_from_context(const re
 template <typename scope_type>
 bool scoped_event_base<scope_type>::is_player_scope(const scope_type *scope)
 {
+	if (game::get()->is_player_ai_controlled()) {
+		return false;
+	}
+
 	if constexpr (std::is_same_v<scope_type, const character>) {
 		return scope == game::get()->get_player_character();
 	} else if constexpr (std::is_same_v<scope_type, const domain>) {
@@ -93,16 +98,21 @@ QCoro::Task<void> scoped_event_base<scope_type>::check_random_events_for_scope(c
 {
 	std::vector<const scoped_event_base *> random_events;
 
-	for (const scoped_event_base *event : potential_events) {
-		if (event == nullptr) {
-			random_events.push_back(event);
-			continue;
-		}
+	{
+		//nothing changes while the weights are calculated
+		const factor_memo_scope memo_scope;
+
+		for (const scoped_event_base *event : potential_events) {
+			if (event == nullptr) {
+				random_events.push_back(event);
+				continue;
+			}
 
-		const int weight = event->get_random_weight_factor()->calculate(scope).to_int();
+			const int weight = event->get_random_weight_factor()->calculate(scope).to_int();
 
-		for (int i = 0; i < weight; ++i) {
-			random_events.push_back(event);
+			for (int i = 0; i < weight; ++i) {
+				random_events.push_back(event);
+			}
 		}
 	}
 
@@ -146,25 +156,28 @@ QCoro::Task<void> scoped_event_base<scope_type>::check_mtth_events_for_scope(con
 {
 	const read_only_context ctx(scope);
 
+	//events from neighbors calculate the same mean time to happen for each nearby province, so the factors are memoized until an event fires
+	std::optional<factor_memo_scope> memo_scope(std::in_place);
+
 	for (const scoped_event_base *event : scoped_event_base::mtth_events) {
 		if constexpr (std::is_same_v<scope_type, const province>) {
 			if (event->is_from_neighbor()) {
 				for (const province *nearby_province : scope->get_map_data()->get_nearby_provinces()) {
 					read_only_context event_ctx(scope);
 					event_ctx.source_scope = nearby_province;
-					co_await scoped_event_base::check_mtth_event_for_scope(event, scope, event_ctx);
+					co_await scoped_event_base::check_mtth_event_for_scope(event, scope, event_ctx, memo_scope);
 				}
 
 				continue;
 			}
 		}
 
-		co_await scoped_event_base::check_mtth_event_for_scope(event, scope, ctx);
+		co_await scoped_event_base::check_mtth_event_for_scope(event, scope, ctx, memo_scope);
 	}
 }
 
 template <typename scope_type>
-QCoro::Task<void> scoped_event_base<scope_type>::check_mtth_event_for_scope(const scoped_event_base *event, const scope_type *scope, const read_only_context &ctx)
+QCoro::Task<void> scoped_event_base<scope_type>::check_mtth_event_for_scope(const scoped_event_base *event, const scope_type *scope, const read_only_context &ctx, std::optional<factor_memo_scope> &memo_scope)
 {
 	if (!event->can_fire(scope, ctx)) {
 		co_return;
@@ -213,6 +226,9 @@ QCoro::Task<void> scoped_event_base<scope_type>::check_mtth_event_for_scope(cons
 	}
 
 	if (should_fire) {
+		//firing the event changes the game state, so the memoized results no longer apply
+		memo_scope.reset();
+
 		co_await event->fire(scope, context(scope));
 
 		if constexpr (std::is_same_v<scope_type, const province>) {
@@ -221,6 +237,8 @@ QCoro::Task<void> scoped_event_base<scope_type>::check_mtth_event_for_scope(cons
 				scope->get_game_data()->get_owner()->get_turn_data()->add_province_spread_technology(scope, province_event->get_spread_technology());
 			}
 		}
+
+		memo_scope.emplace();
 	}
 }
 
@@ -444,6 +462,9 @@ QCoro::Task<void> scoped_event_base<scope_type>::fire(const scope_type *scope, c
 	co_await this->do_immediate_effects(scope, event_ctx);
 
 	if (scoped_event_base::is_player_scope(scope) && !this->is_hidden()) {
+		//show the changes made so far while the player is choosing an option
+		const change_notification_pause notification_pause;
+
 		event_instance *event_instance = this->create_instance(event_ctx);
 		co_await qCoro(const_cast<metternich::event_instance *>(event_instance), &event_instance::finished);
 	} else {
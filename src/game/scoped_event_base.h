@@ -12,6 +12,7 @@ class event;
 class event_instance;
 class province;
 class site;
+class factor_memo_scope;
 enum class event_trigger;
 struct context;
 struct read_only_context;
@@ -82,7 +83,7 @@ public:
 	[[nodiscard]] static QCoro::Task<void> check_random_events_for_scope(const scope_type *scope, const context &ctx, const std::vector<const scoped_event_base *> &potential_events, const int delay);
 	[[nodiscard]] static QCoro::Task<void> check_random_event_groups_for_scope(const scope_type *scope, const event_trigger trigger, const context &ctx);
 	[[nodiscard]] static QCoro::Task<void> check_mtth_events_for_scope(const scope_type *scope);
-	[[nodiscard]] static QCoro::Task<void> check_mtth_event_for_scope(const scoped_event_base *event, const scope_type *scope, const read_only_context &ctx);
+	[[nodiscard]] static QCoro::Task<void> check_mtth_event_for_scope(const scoped_event_base *event, const scope_type *scope, const read_only_context &ctx, std::optional<factor_memo_scope> &memo_scope);
 
 private:
 	static inline std::map<event_trigger, std::vector<const scoped_event_base *>> trigger_events;
@@ -0,0 +1,253 @@
+#include "metternich.h"
+
+#include "database/database.h"
+#include "database/database_setup.h"
+#include "domain/domain.h"
+#include "domain/domain_economy.h"
+#include "domain/domain_game_data.h"
+#include "economy/commodity.h"
+#include "game/game.h"
+#include "game/game_state_hash.h"
+#include "game/scenario.h"
+#include "util/exception_util.h"
+#include "util/log_output_handler.h"
+#include "util/log_util.h"
+#include "util/path_util.h"
+#include "util/random.h"
+#include "util/string_util.h"
+
+#pragma warning(push, 0)
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#pragma warning(pop)
+
+using namespace metternich;
+
+//runs the simulation without the interface, for automated soak and performance runs; the player's domain is controlled by the AI
+//the output records the random seed and the state hash after each turn, so that a later run can replay it and verify that it produces the same hashes
+
+struct headless_options final
+{
+	std::string scenario_identifier;
+	std::string domain_identifier;
+	int turn_count = 0;
+	std::optional<uint32_t> seed;
+	std::filesystem::path output_filepath;
+	std::filesystem::path verify_filepath;
+};
+
+struct recorded_run final
+{
+	std::optional<uint32_t> seed;
+	std::map<int, std::string> state_hashes_by_turn;
+};
+
+static recorded_run read_recorded_run(const std::filesystem::path &filepath)
+{
+	std::ifstream input_file(filepath);
+	if (!input_file) {
+		throw std::runtime_error(std::format("Failed to open recorded run file \"{}\".", path::to_string(filepath)));
+	}
+
+	recorded_run run;
+
+	std::string line;
+	while (std::getline(input_file, line)) {
+		const std::vector<std::string> values = string::split(line, ',');
+
+		if (values.size() == 2 && values.at(0) == "#seed") {
+			run.seed = static_cast<uint32_t>(std::stoul(values.at(1)));
+			continue;
+		}
+
+		if (values.size() < 4 || values.at(0) == "turn") {
+			continue;
+		}
+
+		run.state_hashes_by_turn[std::stoi(values.at(0))] = values.at(3);
+	}
+
+	return run;
+}
+
+static const domain *choose_player_domain(const headless_options &options)
+{
+	if (!options.domain_identifier.empty()) {
+		return domain::get(options.domain_identifier);
+	}
+
+	for (const domain *domain : game::get()->get_scenario()->get_default_domains()) {
+		if (domain->get_game_data()->is_alive() && domain->get_game_data()->is_playable()) {
+			return domain;
+		}
+	}
+
+	for (const domain *domain : game::get()->get_countries()) {
+		if (domain->get_game_data()->is_playable()) {
+			return domain;
+		}
+	}
+
+	throw std::runtime_error(std::format("No playable domain found for scenario \"{}\".", options.scenario_identifier));
+}
+
+static QCoro::Task<void> run(const headless_options options)
+{
+	try {
+		std::optional<recorded_run> verified_run;
+		if (!options.verify_filepath.empty()) {
+			verified_run = read_recorded_run(options.verify_filepath);
+		}
+
+		//seed the random number generator before anything else is done, so that the run can be replayed
+		uint32_t seed = std::random_device()();
+		if (options.seed.has_value()) {
+			seed = options.seed.value();
+		} else if (verified_run.has_value() && verified_run->seed.has_value()) {
+			seed = verified_run->seed.value();
+		}
+		random::get()->get_engine().seed(seed);
+
+		co_await database_setup::load();
+
+		const scenario *scenario = scenario::get(options.scenario_identifier);
+
+		co_await game::get()->setup_scenario_coro(scenario);
+
+		if (game::get()->get_domains().empty()) {
+			throw std::runtime_error(std::format("Failed to set up scenario \"{}\".", options.scenario_identifier));
+		}
+
+		game::get()->set_player_domain(choose_player_domain(options));
+		game::get()->set_player_ai_controlled(true);
+
+		co_await game::get()->start_coro();
+
+		if (!game::get()->is_running()) {
+			throw std::runtime_error(std::format("Failed to start scenario \"{}\".", options.scenario_identifier));
+		}
+
+		std::ofstream output_file(options.output_filepath);
+		if (!output_file) {
+			throw std::runtime_error(std::format("Failed to open output file \"{}\".", path::to_string(options.output_filepath)));
+		}
+
+		output_file << std::format("#seed,{}\n", seed);
+		output_file << "turn,date,milliseconds,state_hash\n";
+
+		for (int i = 0; i < options.turn_count; ++i) {
+			const int turn = game::get()->get_turn();
+			const QDate date = game::get()->get_date();
+
+			QElapsedTimer elapsed_timer;
+			elapsed_timer.start();
+
+			co_await game::get()->do_turn_coro();
+
+			const int64_t elapsed_ms = elapsed_timer.elapsed();
+
+			const std::string state_hash = game_state_hash::calculate().toStdString();
+
+			output_file << std::format("{},{},{},{}\n", turn, date.toString(Qt::ISODate).toStdString(), elapsed_ms, state_hash);
+			output_file.flush();
+
+			if (verified_run.has_value()) {
+				const auto find_iterator = verified_run->state_hashes_by_turn.find(turn);
+				if (find_iterator != verified_run->state_hashes_by_turn.end() && find_iterator->second != state_hash) {
+					throw std::runtime_error(std::format("State hash mismatch in turn {}: expected \"{}\", got \"{}\".", turn, find_iterator->second, state_hash));
+				}
+			}
+		}
+
+		QApplication::exit(EXIT_SUCCESS);
+	} catch (...) {
+		exception::report(std::current_exception());
+		QApplication::exit(EXIT_FAILURE);
+	}
+}
+
+static void on_exit_cleanup()
+{
+	const QObjectList application_children = QApplication::instance()->children();
+	for (QObject *child : application_children) {
+		child->setParent(nullptr);
+	}
+
+	database::get()->clear();
+}
+
+int main(int argc, char **argv)
+{
+	try {
+		const std::filesystem::path output_log_path = std::filesystem::current_path() / "output.log";
+		const std::filesystem::path error_log_path = std::filesystem::current_path() / "error.log";
+		const log_output_handler log_output_handler(output_log_path, error_log_path);
+
+		qInstallMessageHandler(log::log_qt_message);
+
+		//images are still generated by the simulation, so a GUI application is needed, but without a display
+		if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+			qputenv("QT_QPA_PLATFORM", "offscreen");
+		}
+
+		QApplication app(argc, argv);
+		app.setApplicationName("Metternich");
+		app.setApplicationVersion("1.0.0");
+		app.setOrganizationName("Metternich");
+		app.setOrganizationDomain("andrettin.github.io");
+
+		QCommandLineParser parser;
+		parser.setApplicationDescription("Runs the Metternich simulation without the interface.");
+		parser.addHelpOption();
+
+		const QCommandLineOption scenario_option("scenario", "The identifier of the scenario to run.", "scenario");
+		const QCommandLineOption domain_option("domain", "The identifier of the domain to use as the (AI-controlled) player domain.", "domain");
+		const QCommandLineOption turns_option("turns", "The number of turns to run.", "turns", "100");
+		const QCommandLineOption output_option("output", "The file to which per-turn timings and state hashes are written.", "output", "headless_turns.csv");
+		const QCommandLineOption seed_option("seed", "The seed for the random number generator. If not given, the seed of the run being verified or a random one is used.", "seed");
+		const QCommandLineOption verify_option("verify", "A previously written output file, whose run is replayed and whose state hashes are verified against the new ones.", "verify");
+		parser.addOption(scenario_option);
+		parser.addOption(domain_option);
+		parser.addOption(turns_option);
+		parser.addOption(output_option);
+		parser.addOption(seed_option);
+		parser.addOption(verify_option);
+
+		parser.process(app);
+
+		if (!parser.isSet(scenario_option)) {
+			log::log_error("No scenario specified.");
+			parser.showHelp(EXIT_FAILURE);
+		}
+
+		headless_options options;
+		options.scenario_identifier = parser.value(scenario_option).toStdString();
+		options.domain_identifier = parser.value(domain_option).toStdString();
+		options.turn_count = parser.value(turns_option).toInt();
+		options.output_filepath = std::filesystem::path(parser.value(output_option).toStdString());
+
+		if (parser.isSet(seed_option)) {
+			options.seed = parser.value(seed_option).toUInt();
+		}
+
+		if (parser.isSet(verify_option)) {
+			options.verify_filepath = std::filesystem::path(parser.value(verify_option).toStdString());
+		}
+
+		database_setup::add_defines();
+		database_setup::register_enums();
+
+		QTimer::singleShot(0, [options]() -> QCoro::Task<void> {
+			co_await run(options);
+		});
+
+		QObject::connect(&app, &QApplication::aboutToQuit, []() {
+			on_exit_cleanup();
+		});
+
+		return app.exec();
+	} catch (...) {
+		exception::report(std::current_exception());
+		return -1;
+	}
+}
@@ -26,6 +26,13 @@
 
 namespace metternich {
 
+namespace {
+
+thread_local int building_eligibility_cache_depth = 0;
+thread_local std::map<std::pair<const building_slot *, const building_type *>, bool> building_eligibility_cache;
+
+}
+
 building_slot::building_slot(const building_slot_type *type, const site *settlement)
 	: type(type), settlement(settlement)
 {
@@ -203,6 +210,22 @@ bool building_slot::can_have_building(const building_type *building) const
 {
 	assert_throw(building != nullptr);
 
+	if (!building_eligibility_cache_scope::is_active()) {
+		return this->check_building_eligibility(building);
+	}
+
+	const std::optional<bool> cached_eligibility = building_eligibility_cache_scope::find_eligibility(this, building);
+	if (cached_eligibility.has_value()) {
+		return cached_eligibility.value();
+	}
+
+	const bool eligible = this->check_building_eligibility(building);
+	building_eligibility_cache_scope::add_eligibility(this, building, eligible);
+	return eligible;
+}
+
+bool building_slot::check_building_eligibility(const building_type *building) const
+{
 	const site_game_data *settlement_game_data = this->get_settlement()->get_game_data();
 
 	if (settlement_game_data->get_culture()->get_building_class_type(building->get_building_class()) != building) {
@@ -744,4 +767,40 @@ QString building_slot::get_modifier_string() const
 	return QString::fromStdString(str);
 }
 
+bool building_eligibility_cache_scope::is_active()
+{
+	return building_eligibility_cache_depth > 0;
+}
+
+std::optional<bool> building_eligibility_cache_scope::find_eligibility(const building_slot *building_slot, const building_type *building)
+{
+	const auto find_iterator = building_eligibility_cache.find(std::make_pair(building_slot, building));
+	if (find_iterator != building_eligibility_cache.end()) {
+		++building_eligibility_cache_scope::hit_count;
+		return find_iterator->second;
+	}
+
+	++building_eligibility_cache_scope::miss_count;
+	return std::nullopt;
+}
+
+void building_eligibility_cache_scope::add_eligibility(const building_slot *building_slot, const building_type *building, const bool eligible)
+{
+	building_eligibility_cache[std::make_pair(building_slot, building)] = eligible;
+}
+
+building_eligibility_cache_scope::building_eligibility_cache_scope()
+{
+	++building_eligibility_cache_depth;
+}
+
+building_eligibility_cache_scope::~building_eligibility_cache_scope()
+{
+	--building_eligibility_cache_depth;
+
+	if (building_eligibility_cache_depth == 0) {
+		building_eligibility_cache.clear();
+	}
+}
+
 }
@@ -71,6 +71,11 @@ public:
 	void set_under_construction_building(const building_type *building);
 
 	bool can_have_building(const building_type *building) const;
+
+private:
+	bool check_building_eligibility(const building_type *building) const;
+
+public:
 	bool can_maintain_building(const building_type *building) const;
 	bool can_gain_building(const building_type *building) const;
 	bool can_build_building(const building_type *building) const;
@@ -144,4 +149,34 @@ private:
 	std::vector<qunique_ptr<building_item_slot>> item_slots;
 };
 
+//while an instance of this is alive, whether building slots can have given buildings is cached on the current thread, so that scans checking many buildings whose requirements refer to each other (e.g. base buildings) don't check the same conditions again
+//it must only be used around code which doesn't change the game state, since cached results are kept until the outermost scope ends
+class building_eligibility_cache_scope final
+{
+public:
+	static bool is_active();
+	static std::optional<bool> find_eligibility(const building_slot *building_slot, const building_type *building);
+	static void add_eligibility(const building_slot *building_slot, const building_type *building, const bool eligible);
+
+	static int64_t get_hit_count()
+	{
+		return building_eligibility_cache_scope::hit_count;
+	}
+
+	static int64_t get_miss_count()
+	{
+		return building_eligibility_cache_scope::miss_count;
+	}
+
+	building_eligibility_cache_scope();
+	~building_eligibility_cache_scope();
+
+	building_eligibility_cache_scope(const building_eligibility_cache_scope &other) = delete;
+	building_eligibility_cache_scope &operator =(const building_eligibility_cache_scope &other) = delete;
+
+private:
+	static inline std::atomic<int64_t> hit_count = 0;
+	static inline std::atomic<int64_t> miss_count = 0;
+};
+
 }
@@ -22,6 +22,7 @@
 #include "script/factor.h"
 #include "script/modifier.h"
 #include "technology/technology.h"
+#include "ui/text_cache.h"
 #include "ui/ui_defines.h"
 #include "unit/civilian_unit_type.h"
 #include "unit/military_unit_category.h"
@@ -584,18 +585,20 @@ QString building_type::get_effects_string(const metternich::site *site, const bo
 {
 	assert_throw(site->is_settlement());
 
-	std::string str = this->get_modifier_string(site, single_line);
+	return text_cache::get()->get(this, site, single_line ? 1 : 0, [this, site, single_line]() {
+		std::string str = this->get_modifier_string(site, single_line);
 
-	if (this->get_effects() != nullptr) {
-		if (!str.empty()) {
-			str += single_line ? ", " : "\n";
-		}
+		if (this->get_effects() != nullptr) {
+			if (!str.empty()) {
+				str += single_line ? ", " : "\n";
+			}
 
-		const read_only_context ctx(site);
-		str += single_line ? this->get_effects()->get_effects_single_line_string(site, ctx) : this->get_effects()->get_effects_string(site, ctx);
-	}
+			const read_only_context ctx(site);
+			str += single_line ? this->get_effects()->get_effects_single_line_string(site, ctx) : this->get_effects()->get_effects_string(site, ctx);
+		}
 
-	return QString::fromStdString(str);
+		return QString::fromStdString(str);
+	});
 }
 
 }
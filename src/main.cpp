@@ -1,52 +1,33 @@
 #include "metternich.h"
 
-#include "character/bloodline_strength_category.h"
 #include "character/character.h"
 #include "character/character_attribute.h"
-#include "character/character_attribute_type.h"
 #include "character/character_data_model.h"
-#include "character/character_defines.h"
 #include "character/character_game_data.h"
 #include "character/dynasty.h"
 #include "character/family_tree_model.h"
-#include "character/profession_profitability.h"
-#include "character/starting_age_category.h"
 #include "character/trait.h"
 #include "character/trait_type.h"
-#include "culture/cultural_group_rank.h"
 #include "database/database.h"
-#include "database/database_enum_util.h"
+#include "database/database_setup.h"
 #include "database/defines.h"
 #include "database/preferences.h"
 #include "domain/consulate.h"
-#include "domain/country_type.h"
-#include "domain/diplomacy_state.h"
 #include "domain/domain.h"
 #include "domain/domain_attribute.h"
 #include "domain/domain_game_data.h"
-#include "domain/domain_tier.h"
 #include "domain/domain_tier_data.h"
 #include "domain/domain_turn_data.h"
 #include "domain/government_type.h"
 #include "domain/idea.h"
 #include "domain/idea_slot.h"
-#include "domain/idea_type.h"
 #include "domain/journal_entry.h"
 #include "domain/law.h"
 #include "domain/law_group.h"
-#include "domain/succession_gender_type.h"
-#include "domain/succession_type.h"
-#include "economy/commodity_type.h"
 #include "economy/commodity_unit.h"
-#include "economy/food_type.h"
-#include "economy/province_taxation_type.h"
 #include "engine_interface.h"
-#include "game/attack_result.h"
-#include "game/battle_resolution_type.h"
-#include "game/decision_type.h"
 #include "game/event.h"
 #include "game/event_instance.h"
-#include "game/event_trigger.h"
 #include "game/game.h"
 #include "game/game_rule.h"
 #include "game/game_rule_group.h"
@@ -56,35 +37,22 @@
 #include "infrastructure/building_type.h"
 #include "infrastructure/pathway.h"
 #include "infrastructure/wonder.h"
-#include "item/affix_type.h"
 #include "item/item.h"
 #include "item/item_slot.h"
-#include "language/grammatical_gender.h"
-#include "language/word_type.h"
 #include "map/combat_map_grid_model.h"
 #include "map/diplomatic_map_image_provider.h"
-#include "map/elevation_type.h"
-#include "map/forestation_type.h"
 #include "map/map.h"
 #include "map/map_grid_model.h"
 #include "map/map_template.h"
-#include "map/moisture_type.h"
 #include "map/province.h"
 #include "map/province_game_data.h"
 #include "map/site.h"
 #include "map/site_attribute.h"
 #include "map/site_game_data.h"
-#include "map/site_type.h"
-#include "map/temperature_type.h"
 #include "map/tile_image_provider.h"
 #include "population/population.h"
-#include "population/population_defines.h"
-#include "population/population_strata.h"
 #include "population/population_type.h"
 #include "script/scripted_character_modifier.h"
-#include "species/geological_era.h"
-#include "species/taxonomic_rank.h"
-#include "spell/spell_target.h"
 #include "technology/technology.h"
 #include "technology/technology_category.h"
 #include "technology/technology_model.h"
@@ -93,17 +61,14 @@
 #include "ui/icon.h"
 #include "ui/icon_image_provider.h"
 #include "ui/interface_image_provider.h"
+#include "ui/object_list_model.h"
 #include "ui/portrait.h"
 #include "ui/portrait_image_provider.h"
 #include "ui/ui_defines.h"
 #include "unit/civilian_unit_type.h"
-#include "unit/military_unit_category.h"
-#include "unit/military_unit_domain.h"
 #include "unit/military_unit_type.h"
-#include "unit/transporter_category.h"
 #include "util/empty_image_provider.h"
 #include "util/exception_util.h"
-#include "util/gender.h"
 #include "util/log_output_handler.h"
 #include "util/log_util.h"
 #include "util/path_util.h"
@@ -124,14 +89,7 @@ using namespace metternich;
 static QCoro::Task<void> initialize()
 {
 	try {
-		co_await database::get()->load(true);
-		database::get()->load_defines();
-		co_await database::get()->load(false);
-
-		//load the preferences before initializing the database, so that is any initialization depends on the scale factor, it can work properly
-		preferences::get()->load();
-
-		database::get()->initialize();
+		co_await database_setup::load();
 
 		co_await cursor::set_current_cursor(ui_defines::get()->get_default_cursor());
 
@@ -175,48 +133,11 @@ int main(int argc, char **argv)
 
 		QImageReader::setAllocationLimit(1024);
 
-		database::get()->add_defines(defines::get());
-		database::get()->add_defines(character_defines::get());
-		database::get()->add_defines(population_defines::get());
-		database::get()->add_defines(ui_defines::get());
+		database_setup::add_defines();
 
 		QQmlApplicationEngine engine;
 
-		database_util::register_enum<affix_type>();
-		database_util::register_enum<attack_result>();
-		database_util::register_enum<battle_resolution_type>();
-		database_util::register_enum<bloodline_strength_category>();
-		database_util::register_enum<character_attribute_type>();
-		database_util::register_enum<commodity_type>();
-		database_util::register_enum<country_type>();
-		database_util::register_enum<cultural_group_rank>();
-		database_util::register_enum<decision_type>();
-		database_util::register_enum<diplomacy_state>();
-		database_util::register_enum<domain_tier>();
-		database_util::register_enum<elevation_type>();
-		database_util::register_enum<event_trigger>();
-		database_util::register_enum<food_type>();
-		database_util::register_enum<forestation_type>();
-		database_util::register_enum<gender>();
-		database_util::register_enum<geological_era>();
-		database_util::register_enum<grammatical_gender>();
-		database_util::register_enum<idea_type>();
-		database_util::register_enum<log_level>();
-		database_util::register_enum<military_unit_category>();
-		database_util::register_enum<military_unit_domain>();
-		database_util::register_enum<moisture_type>();
-		database_util::register_enum<population_strata>();
-		database_util::register_enum<profession_profitability>();
-		database_util::register_enum<province_taxation_type>();
-		database_util::register_enum<site_type>();
-		database_util::register_enum<spell_target>();
-		database_util::register_enum<starting_age_category>();
-		database_util::register_enum<succession_gender_type>();
-		database_util::register_enum<succession_type>();
-		database_util::register_enum<taxonomic_rank>();
-		database_util::register_enum<temperature_type>();
-		database_util::register_enum<transporter_category>();
-		database_util::register_enum<word_type>();
+		database_setup::register_enums();
 
 		QCoro::Qml::registerTypes();
 
@@ -259,6 +180,7 @@ int main(int argc, char **argv)
 		qmlRegisterAnonymousType<map_template>("", 1);
 		qmlRegisterAnonymousType<military_unit_type>("", 1);
 		qmlRegisterAnonymousType<const military_unit_type>("", 1);
+		qmlRegisterAnonymousType<object_list_model>("", 1);
 		qmlRegisterAnonymousType<pathway>("", 1);
 		qmlRegisterAnonymousType<const pathway>("", 1);
 		qmlRegisterAnonymousType<population>("", 1);
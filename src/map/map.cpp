@@ -10,16 +10,21 @@
 #include "domain/domain_technology.h"
 #include "economy/resource.h"
 #include "game/game.h"
+#include "map/map_block_index.h"
 #include "map/province.h"
+#include "map/province_adjacency_graph.h"
 #include "map/province_container.h"
 #include "map/province_map_data.h"
+#include "map/province_pathfinder.h"
 #include "map/route.h"
+#include "map/route_game_data.h"
 #include "map/site.h"
 #include "map/site_game_data.h"
 #include "map/site_map_data.h"
 #include "map/site_type.h"
 #include "map/terrain_type.h"
 #include "map/tile.h"
+#include "ui/image_scaling.h"
 #include "util/assert_util.h"
 #include "util/container_util.h"
 #include "util/exception_util.h"
@@ -29,8 +34,6 @@
 #include "util/vector_util.h"
 #include "util/vector_random_util.h"
 
-#include "xbrz.h"
-
 namespace metternich {
 
 map::map()
@@ -83,6 +86,7 @@ void map::process_gsml_scope(const gsml_data &scope)
 		});
 
 		QCoro::waitFor(this->process_border_tiles());
+		this->create_province_adjacency_graph();
 		for (const province *province : this->get_provinces()) {
 			province->get_map_data()->on_map_created();
 		}
@@ -175,6 +179,8 @@ QCoro::Task<void> map::initialize(const bool province_post_processing_enabled)
 	this->provinces = std::move(provinces);
 	this->sites = std::move(sites);
 
+	this->create_province_adjacency_graph();
+
 	for (const province *province : this->get_provinces()) {
 		province->get_map_data()->on_map_created();
 	}
@@ -272,8 +278,8 @@ QCoro::Task<void> map::process_border_tiles()
 					const metternich::province *adjacent_province = adjacent_tile->get_province();
 
 					if (province != adjacent_province) {
-						if (adjacent_province != nullptr && !vector::contains(province_map_data->get_neighbor_provinces(), adjacent_province)) {
-							province_map_data->add_neighbor_province(adjacent_province);
+						if (adjacent_province != nullptr) {
+							province_map_data->add_border_with(adjacent_province);
 						}
 
 						is_border_tile = true;
@@ -310,7 +316,12 @@ void map::clear()
 
 	this->provinces.clear();
 	this->sites.clear();
+	this->block_index.reset();
+	this->province_adjacency.reset();
+	province_pathfinder::get()->invalidate();
 	this->tiles.reset();
+	this->diplomatic_map_province_raster.clear();
+	this->diplomatic_map_province_raster_size = QSize();
 	this->ocean_diplomatic_map_image = QImage();
 	this->empty_diplomatic_map_image = QImage();
 	this->empty_terrain_diplomatic_map_image = QImage();
@@ -523,6 +534,35 @@ QVariantList map::get_sites_qvariant_list() const
 	return container::to_qvariant_list(this->get_sites());
 }
 
+void map::create_province_adjacency_graph()
+{
+	this->province_adjacency = std::make_unique<province_adjacency_graph>(this->get_provinces());
+}
+
+void map::create_map_block_index()
+{
+	//route map rects are only available after setup has finished, so the index is created when the game starts
+	auto block_index = std::make_unique<map_block_index>(QSize(this->get_map_block_grid_width(), this->get_map_block_grid_height()), defines::get()->get_map_block_size());
+
+	for (const province *province : this->get_provinces()) {
+		block_index->add_province(province);
+	}
+
+	for (const site *site : this->get_sites()) {
+		block_index->add_site(site);
+	}
+
+	for (const route *route : route::get_all()) {
+		if (!route->get_game_data()->is_on_map()) {
+			continue;
+		}
+
+		block_index->add_route(route);
+	}
+
+	this->block_index = std::move(block_index);
+}
+
 void map::initialize_diplomatic_map()
 {
 	const decimillesimal_int &tile_scale = this->get_diplomatic_map_tile_scale();
@@ -544,6 +584,34 @@ void map::initialize_province_map()
 	}
 }
 
+void map::create_diplomatic_map_province_raster()
+{
+	const decimillesimal_int &tile_scale = this->get_diplomatic_map_tile_scale();
+	QSize raster_size;
+	if (tile_scale < 1) {
+		raster_size = this->get_size() * tile_scale;
+	} else {
+		raster_size = this->get_size();
+	}
+
+	this->diplomatic_map_province_raster.assign(static_cast<size_t>(raster_size.width()) * raster_size.height(), -1);
+	this->diplomatic_map_province_raster_size = raster_size;
+
+	for (int y = 0; y < raster_size.height(); ++y) {
+		for (int x = 0; x < raster_size.width(); ++x) {
+			const QPoint pixel_pos = QPoint(x, y);
+			const QPoint tile_pos = tile_scale < 1 ? pixel_pos / tile_scale : pixel_pos;
+			const tile *tile = this->get_tile(tile_pos);
+
+			if (tile->get_province() == nullptr) {
+				continue;
+			}
+
+			this->diplomatic_map_province_raster[point::to_index(pixel_pos, raster_size.width())] = tile->get_province()->get_map_data()->get_index();
+		}
+	}
+}
+
 QCoro::Task<void> map::create_ocean_diplomatic_map_image()
 {
 	const decimillesimal_int &tile_scale = this->get_diplomatic_map_tile_scale();
@@ -581,9 +649,7 @@ QCoro::Task<void> map::create_ocean_diplomatic_map_image()
 		QImage scaled_ocean_diplomatic_map_image;
 
 		co_await QtConcurrent::run([this, tile_scale, &scaled_ocean_diplomatic_map_image]() {
-			scaled_ocean_diplomatic_map_image = image::scale<QImage::Format_ARGB32>(this->ocean_diplomatic_map_image, centesimal_int(tile_scale), [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-				xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-			});
+			scaled_ocean_diplomatic_map_image = image_scaling::scale(this->ocean_diplomatic_map_image, centesimal_int(tile_scale));
 		});
 
 		this->ocean_diplomatic_map_image = std::move(scaled_ocean_diplomatic_map_image);
@@ -666,9 +732,7 @@ QCoro::Task<void> map::create_empty_diplomatic_map_image()
 		QImage scaled_empty_diplomatic_map_image;
 
 		co_await QtConcurrent::run([this, tile_scale, &scaled_empty_diplomatic_map_image]() {
-			scaled_empty_diplomatic_map_image = image::scale<QImage::Format_ARGB32>(this->empty_diplomatic_map_image, centesimal_int(tile_scale), [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-				xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-			});
+			scaled_empty_diplomatic_map_image = image_scaling::scale(this->empty_diplomatic_map_image, centesimal_int(tile_scale));
 		});
 
 		this->empty_diplomatic_map_image = std::move(scaled_empty_diplomatic_map_image);
@@ -750,9 +814,7 @@ QCoro::Task<void> map::create_empty_terrain_diplomatic_map_image()
 		QImage scaled_empty_terrain_diplomatic_map_image;
 
 		co_await QtConcurrent::run([this, tile_scale, &scaled_empty_terrain_diplomatic_map_image]() {
-			scaled_empty_terrain_diplomatic_map_image = image::scale<QImage::Format_ARGB32>(this->empty_terrain_diplomatic_map_image, centesimal_int(tile_scale), [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-				xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-			});
+			scaled_empty_terrain_diplomatic_map_image = image_scaling::scale(this->empty_terrain_diplomatic_map_image, centesimal_int(tile_scale));
 		});
 
 		this->empty_terrain_diplomatic_map_image = std::move(scaled_empty_terrain_diplomatic_map_image);
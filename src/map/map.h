@@ -11,7 +11,9 @@ namespace archimedes {
 
 namespace metternich {
 
+class map_block_index;
 class province;
+class province_adjacency_graph;
 class resource;
 class site;
 class terrain_type;
@@ -123,9 +125,35 @@ public:
 		this->sites.push_back(site);
 	}
 
+	const province_adjacency_graph *get_province_adjacency_graph() const
+	{
+		return this->province_adjacency.get();
+	}
+
+	void create_province_adjacency_graph();
+
+	const map_block_index *get_map_block_index() const
+	{
+		return this->block_index.get();
+	}
+
+	void create_map_block_index();
+
 	void initialize_diplomatic_map();
 	void initialize_province_map();
 
+	const std::vector<int> &get_diplomatic_map_province_raster() const
+	{
+		return this->diplomatic_map_province_raster;
+	}
+
+	const QSize &get_diplomatic_map_province_raster_size() const
+	{
+		return this->diplomatic_map_province_raster_size;
+	}
+
+	void create_diplomatic_map_province_raster();
+
 	const QImage &get_ocean_diplomatic_map_image() const
 	{
 		return this->ocean_diplomatic_map_image;
@@ -216,11 +244,15 @@ private:
 	std::unique_ptr<std::vector<tile>> tiles;
 	std::vector<province *> provinces; //the provinces which are on the map
 	std::vector<const site *> sites; //the sites which are on the map
+	std::unique_ptr<map_block_index> block_index;
+	std::unique_ptr<province_adjacency_graph> province_adjacency;
 	QImage ocean_diplomatic_map_image;
 	QImage empty_diplomatic_map_image; //diplomatic map image for ownerless land provinces
 	QImage empty_terrain_diplomatic_map_image; //terrain diplomatic map image for ownerless land provinces
 	QSize diplomatic_map_image_size;
 	decimillesimal_int diplomatic_map_tile_scale = decimillesimal_int(1);
+	std::vector<int> diplomatic_map_province_raster; //the index in the province list of the province for each pixel of the unscaled diplomatic map, or -1 if the pixel has no province; shared by the diplomatic map images of all domains
+	QSize diplomatic_map_province_raster_size;
 	QSize province_map_image_size;
 	QImage minimap_image;
 	decimillesimal_int minimap_tile_scale = decimillesimal_int(1);
@@ -0,0 +1,85 @@
+#include "metternich.h"
+
+#include "map/map_block_index.h"
+
+#include "map/province.h"
+#include "map/province_map_data.h"
+#include "map/route.h"
+#include "map/route_game_data.h"
+#include "map/site.h"
+#include "map/site_map_data.h"
+#include "util/assert_util.h"
+#include "util/point_util.h"
+
+namespace metternich {
+
+map_block_index::map_block_index(const QSize &map_block_grid_size, const QSize &map_block_size)
+	: map_block_grid_size(map_block_grid_size), map_block_size(map_block_size)
+{
+	assert_throw(!map_block_size.isEmpty());
+
+	this->map_blocks.resize(map_block_grid_size.width() * map_block_grid_size.height());
+}
+
+void map_block_index::add_province(const province *province)
+{
+	const QRect &territory_rect = province->get_map_data()->get_territory_rect();
+
+	this->for_each_map_block_in_tile_rect(territory_rect, [this, province](const QPoint &map_block_pos) {
+		this->get_map_block_data(map_block_pos).provinces.push_back(province);
+	});
+}
+
+void map_block_index::add_site(const site *site)
+{
+	const QPoint &tile_pos = site->get_map_data()->get_tile_pos();
+
+	this->for_each_map_block_in_tile_rect(QRect(tile_pos, QSize(1, 1)), [this, site](const QPoint &map_block_pos) {
+		this->get_map_block_data(map_block_pos).sites.push_back(site);
+	});
+}
+
+void map_block_index::add_route(const route *route)
+{
+	const QRect &route_rect = route->get_game_data()->get_map_rect();
+
+	this->for_each_map_block_in_tile_rect(route_rect, [this, route](const QPoint &map_block_pos) {
+		this->get_map_block_data(map_block_pos).routes.push_back(route);
+	});
+}
+
+const map_block_data &map_block_index::get_map_block_data(const QPoint &map_block_pos) const
+{
+	return this->map_blocks.at(point::to_index(map_block_pos, this->get_map_block_grid_size().width()));
+}
+
+std::vector<const site *> map_block_index::get_sites_in_rect(const QRect &tile_rect) const
+{
+	std::vector<const site *> sites;
+
+	this->for_each_map_block_in_tile_rect(tile_rect, [this, &tile_rect, &sites](const QPoint &map_block_pos) {
+		for (const site *site : this->get_map_block_data(map_block_pos).sites) {
+			if (tile_rect.contains(site->get_map_data()->get_tile_pos())) {
+				sites.push_back(site);
+			}
+		}
+	});
+
+	return sites;
+}
+
+QRect map_block_index::get_map_block_rect_for_tile_rect(const QRect &tile_rect) const
+{
+	if (tile_rect.isEmpty()) {
+		return QRect();
+	}
+
+	const int start_x = std::max(0, tile_rect.left() / this->map_block_size.width());
+	const int start_y = std::max(0, tile_rect.top() / this->map_block_size.height());
+	const int end_x = std::min(this->get_map_block_grid_size().width() - 1, tile_rect.right() / this->map_block_size.width());
+	const int end_y = std::min(this->get_map_block_grid_size().height() - 1, tile_rect.bottom() / this->map_block_size.height());
+
+	return QRect(QPoint(start_x, start_y), QPoint(end_x, end_y));
+}
+
+}
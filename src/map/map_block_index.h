@@ -0,0 +1,61 @@
+#pragma once
+
+namespace metternich {
+
+class province;
+class route;
+class site;
+
+struct map_block_data final
+{
+	std::vector<const province *> provinces;
+	std::vector<const site *> sites;
+	std::vector<const route *> routes;
+};
+
+//spatial index bucketing the provinces, sites and routes on the map by the map blocks they overlap, so that range queries need not scan every entity on the map
+class map_block_index final
+{
+public:
+	explicit map_block_index(const QSize &map_block_grid_size, const QSize &map_block_size);
+
+	void add_province(const province *province);
+	void add_site(const site *site);
+	void add_route(const route *route);
+
+	const QSize &get_map_block_grid_size() const
+	{
+		return this->map_block_grid_size;
+	}
+
+	const map_block_data &get_map_block_data(const QPoint &map_block_pos) const;
+
+	std::vector<const site *> get_sites_in_rect(const QRect &tile_rect) const;
+
+private:
+	QRect get_map_block_rect_for_tile_rect(const QRect &tile_rect) const;
+
+	template <typename function_type>
+	void for_each_map_block_in_tile_rect(const QRect &tile_rect, const function_type &function) const
+	{
+		const QRect map_block_rect = this->get_map_block_rect_for_tile_rect(tile_rect);
+
+		for (int x = map_block_rect.left(); x <= map_block_rect.right(); ++x) {
+			for (int y = map_block_rect.top(); y <= map_block_rect.bottom(); ++y) {
+				function(QPoint(x, y));
+			}
+		}
+	}
+
+	map_block_data &get_map_block_data(const QPoint &map_block_pos)
+	{
+		return const_cast<map_block_data &>(std::as_const(*this).get_map_block_data(map_block_pos));
+	}
+
+private:
+	QSize map_block_grid_size;
+	QSize map_block_size;
+	std::vector<map_block_data> map_blocks;
+};
+
+}
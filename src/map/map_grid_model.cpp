@@ -4,12 +4,11 @@
 
 #include "database/defines.h"
 #include "map/map.h"
+#include "map/map_block_index.h"
 #include "map/province.h"
-#include "map/province_map_data.h"
 #include "map/route.h"
-#include "map/route_game_data.h"
 #include "map/site.h"
-#include "map/site_map_data.h"
+#include "util/assert_util.h"
 #include "util/container_util.h"
 #include "util/exception_util.h"
 #include "util/point_util.h"
@@ -18,44 +17,32 @@ namespace metternich {
 
 map_grid_model::map_grid_model()
 {
+	const map_block_index *block_index = map::get()->get_map_block_index();
+	assert_throw(block_index != nullptr);
+
 	const int map_grid_width = map::get()->get_map_block_grid_width();
 	const int map_grid_height = map::get()->get_map_block_grid_height();
 
-	this->map_block_data.resize(map_grid_width * map_grid_height);
+	this->map_block_qvariant_data.resize(map_grid_width * map_grid_height);
 
 	for (int x = 0; x < map_grid_width; ++x) {
 		for (int y = 0; y < map_grid_height; ++y) {
-			const int map_block_index = point::to_index(x, y, map_grid_width);
+			const QPoint map_block_pos(x, y);
+			const int map_block_index = point::to_index(map_block_pos, map_grid_width);
 			const int map_block_start_x = x * defines::get()->get_map_block_size().width();
 			const int map_block_start_y = y * defines::get()->get_map_block_size().height();
-			const QRect map_block_rect(QPoint(map_block_start_x, map_block_start_y), defines::get()->get_map_block_size());
 
-			metternich::map_block_data &map_block_data = this->map_block_data.at(map_block_index);
+			const metternich::map_block_data &map_block_data = block_index->get_map_block_data(map_block_pos);
+			metternich::map_block_qvariant_data &map_block_qvariant_data = this->map_block_qvariant_data.at(map_block_index);
 
-			for (const province *province : map::get()->get_provinces()) {
-				if (province->get_map_data()->get_territory_rect().intersects(map_block_rect)) {
-					map_block_data.provinces.push_back(province);
-				}
-			}
+			map_block_qvariant_data.provinces = container::to_qvariant_list(map_block_data.provinces);
 
+			//sites are displayed in a map block if they are near enough to it, even if they are outside of it
 			static const int site_map_range = (12 / defines::get()->get_province_map_tile_scale() / 2) + 1;
 			const QRect map_block_site_rect(QPoint(map_block_start_x - site_map_range, map_block_start_y - site_map_range), defines::get()->get_map_block_size() + QSize(site_map_range * 2, site_map_range * 2));
+			map_block_qvariant_data.sites = container::to_qvariant_list(block_index->get_sites_in_rect(map_block_site_rect));
 
-			for (const site *site : map::get()->get_sites()) {
-				if (map_block_site_rect.contains(site->get_map_data()->get_tile_pos())) {
-					map_block_data.sites.push_back(site);
-				}
-			}
-
-			for (const route *route : route::get_all()) {
-				if (!route->get_game_data()->is_on_map()) {
-					continue;
-				}
-
-				if (route->get_game_data()->get_map_rect().intersects(map_block_rect)) {
-					map_block_data.routes.push_back(route);
-				}
-			}
+			map_block_qvariant_data.routes = container::to_qvariant_list(map_block_data.routes);
 		}
 	}
 }
@@ -85,15 +72,15 @@ QVariant map_grid_model::data(const QModelIndex &index, const int role) const
 
 		const int map_block_x = index.column();
 		const int map_block_y = index.row();
-		const metternich::map_block_data &map_block_data = this->map_block_data.at(point::to_index(map_block_x, map_block_y, map::get()->get_map_block_grid_width()));
+		const metternich::map_block_qvariant_data &map_block_qvariant_data = this->map_block_qvariant_data.at(point::to_index(map_block_x, map_block_y, map::get()->get_map_block_grid_width()));
 
 		switch (model_role) {
 			case role::provinces:
-				return container::to_qvariant_list(map_block_data.provinces);
+				return map_block_qvariant_data.provinces;
 			case role::sites:
-				return container::to_qvariant_list(map_block_data.sites);
+				return map_block_qvariant_data.sites;
 			case role::routes:
-				return container::to_qvariant_list(map_block_data.routes);
+				return map_block_qvariant_data.routes;
 			case role::map_block_start_x:
 				return map_block_x * defines::get()->get_map_block_size().width();
 			case role::map_block_start_y:
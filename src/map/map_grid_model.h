@@ -6,15 +6,11 @@
 
 namespace metternich {
 
-class province;
-class route;
-class site;
-
-struct map_block_data final
+struct map_block_qvariant_data final
 {
-	std::vector<const province *> provinces;
-	std::vector<const site *> sites;
-	std::vector<const route *> routes;
+	QVariantList provinces;
+	QVariantList sites;
+	QVariantList routes;
 };
 
 class map_grid_model : public QAbstractItemModel
@@ -68,7 +64,7 @@ public:
 	}
 
 private:
-	std::vector<map_block_data> map_block_data;
+	std::vector<map_block_qvariant_data> map_block_qvariant_data; //cached per map block, so that the lists need not be rebuilt on each data request
 };
 
 }
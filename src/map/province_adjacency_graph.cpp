@@ -0,0 +1,124 @@
+#include "metternich.h"
+
+#include "map/province_adjacency_graph.h"
+
+#include "map/province.h"
+#include "map/province_map_data.h"
+#include "util/assert_util.h"
+#include "util/vector_util.h"
+
+namespace metternich {
+
+province_adjacency_graph::province_adjacency_graph(const std::vector<province *> &provinces)
+{
+	for (size_t i = 0; i < provinces.size(); ++i) {
+		provinces[i]->get_map_data()->set_index(static_cast<int>(i));
+	}
+
+	this->build_neighbors(provinces);
+	this->build_nearby_provinces(provinces);
+
+	for (size_t i = 0; i < provinces.size(); ++i) {
+		provinces[i]->get_map_data()->set_adjacency(this->get_neighbor_provinces(i), this->get_nearby_provinces(i));
+	}
+}
+
+void province_adjacency_graph::build_neighbors(const std::vector<province *> &provinces)
+{
+	this->neighbor_offsets.reserve(provinces.size() + 1);
+	this->neighbor_offsets.push_back(0);
+
+	for (const province *province : provinces) {
+		const std::vector<std::pair<const metternich::province *, int>> &border_lengths = province->get_map_data()->get_border_lengths();
+
+		for (const auto &[neighbor_province, border_length] : border_lengths) {
+			//provinces which are not on the map can still border tiles on it during map creation, but are not part of the graph
+			if (neighbor_province->get_map_data()->get_index() == -1) {
+				continue;
+			}
+
+			this->neighbor_provinces.push_back(neighbor_province);
+			this->neighbor_border_lengths.push_back(border_length);
+		}
+
+		this->neighbor_offsets.push_back(static_cast<uint32_t>(this->neighbor_provinces.size()));
+	}
+}
+
+void province_adjacency_graph::build_nearby_provinces(const std::vector<province *> &provinces)
+{
+	const size_t province_count = provinces.size();
+
+	std::vector<std::vector<const province *>> nearby_provinces_by_index(province_count);
+	std::vector<std::vector<uint8_t>> nearby_water_connections_by_index(province_count);
+
+	const size_t thread_count = static_cast<size_t>(std::max(1, QThread::idealThreadCount()));
+	const size_t provinces_per_slice = std::max<size_t>(1, (province_count + thread_count - 1) / thread_count);
+
+	std::vector<std::pair<size_t, size_t>> slices;
+	for (size_t first = 0; first < province_count; first += provinces_per_slice) {
+		slices.emplace_back(first, std::min(first + provinces_per_slice, province_count));
+	}
+
+	//each slice only writes the lists of its own provinces, and the neighbor rows are no longer modified, so the slices can be processed concurrently
+	QtConcurrent::blockingMap(slices, [this, &provinces, &nearby_provinces_by_index, &nearby_water_connections_by_index, province_count](const std::pair<size_t, size_t> &slice) {
+		//marks which provinces are already in the list being built, reset after each province by unmarking only the ones which were added
+		std::vector<bool> listed_provinces(province_count, false);
+
+		for (size_t i = slice.first; i < slice.second; ++i) {
+			const province *province = provinces[i];
+			std::vector<const metternich::province *> &nearby_provinces = nearby_provinces_by_index[i];
+			std::vector<uint8_t> &nearby_water_connections = nearby_water_connections_by_index[i];
+
+			listed_provinces[i] = true;
+
+			for (const metternich::province *neighbor_province : this->get_neighbor_provinces(i)) {
+				listed_provinces[neighbor_province->get_map_data()->get_index()] = true;
+				nearby_provinces.push_back(neighbor_province);
+				nearby_water_connections.push_back(0);
+			}
+
+			//add provinces connected by a water zone to the nearby provinces list
+			if (!province->is_water_zone()) {
+				for (const metternich::province *neighbor_province : this->get_neighbor_provinces(i)) {
+					if (!neighbor_province->is_water_zone()) {
+						continue;
+					}
+
+					for (const metternich::province *nearby_province : this->get_neighbor_provinces(neighbor_province->get_map_data()->get_index())) {
+						if (nearby_province->is_water_zone()) {
+							continue;
+						}
+
+						const int nearby_province_index = nearby_province->get_map_data()->get_index();
+						if (listed_provinces[nearby_province_index]) {
+							continue;
+						}
+
+						listed_provinces[nearby_province_index] = true;
+						nearby_provinces.push_back(nearby_province);
+						nearby_water_connections.push_back(1);
+					}
+				}
+			}
+
+			listed_provinces[i] = false;
+			for (const metternich::province *nearby_province : nearby_provinces) {
+				listed_provinces[nearby_province->get_map_data()->get_index()] = false;
+			}
+		}
+	});
+
+	this->nearby_offsets.reserve(province_count + 1);
+	this->nearby_offsets.push_back(0);
+
+	for (size_t i = 0; i < province_count; ++i) {
+		vector::merge(this->nearby_provinces, std::move(nearby_provinces_by_index[i]));
+		vector::merge(this->nearby_water_connections, std::move(nearby_water_connections_by_index[i]));
+		this->nearby_offsets.push_back(static_cast<uint32_t>(this->nearby_provinces.size()));
+	}
+
+	assert_throw(this->nearby_water_connections.size() == this->nearby_provinces.size());
+}
+
+}
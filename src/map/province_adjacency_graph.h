@@ -0,0 +1,62 @@
+#pragma once
+
+namespace metternich {
+
+class province;
+
+//adjacency of the provinces on the map in compressed sparse row form, indexed by the provinces' index in the map's province list
+//neighbors are provinces sharing a border; nearby provinces are the neighbors plus the land provinces connected to a land province by a neighboring water zone
+class province_adjacency_graph final
+{
+public:
+	explicit province_adjacency_graph(const std::vector<province *> &provinces);
+
+	size_t get_province_count() const
+	{
+		return this->neighbor_offsets.size() - 1;
+	}
+
+	std::span<const province * const> get_neighbor_provinces(const size_t province_index) const
+	{
+		return province_adjacency_graph::get_row(this->neighbor_provinces, this->neighbor_offsets, province_index);
+	}
+
+	//the number of tile edges shared with each neighbor, in the same order as the neighbors
+	std::span<const int> get_neighbor_border_lengths(const size_t province_index) const
+	{
+		return province_adjacency_graph::get_row(this->neighbor_border_lengths, this->neighbor_offsets, province_index);
+	}
+
+	std::span<const province * const> get_nearby_provinces(const size_t province_index) const
+	{
+		return province_adjacency_graph::get_row(this->nearby_provinces, this->nearby_offsets, province_index);
+	}
+
+	//whether each nearby province is only connected through a water zone, in the same order as the nearby provinces
+	std::span<const uint8_t> get_nearby_water_connections(const size_t province_index) const
+	{
+		return province_adjacency_graph::get_row(this->nearby_water_connections, this->nearby_offsets, province_index);
+	}
+
+private:
+	template <typename value_type>
+	static std::span<const value_type> get_row(const std::vector<value_type> &values, const std::vector<uint32_t> &offsets, const size_t index)
+	{
+		const uint32_t begin = offsets.at(index);
+		const uint32_t end = offsets.at(index + 1);
+		return std::span<const value_type>(values.data() + begin, end - begin);
+	}
+
+	void build_neighbors(const std::vector<province *> &provinces);
+	void build_nearby_provinces(const std::vector<province *> &provinces);
+
+private:
+	std::vector<uint32_t> neighbor_offsets;
+	std::vector<const province *> neighbor_provinces;
+	std::vector<int> neighbor_border_lengths;
+	std::vector<uint32_t> nearby_offsets;
+	std::vector<const province *> nearby_provinces;
+	std::vector<uint8_t> nearby_water_connections;
+};
+
+}
@@ -35,6 +35,7 @@
 #include "map/province_feature.h"
 #include "map/province_map_data.h"
 #include "map/province_map_mode.h"
+#include "map/province_pathfinder.h"
 #include "map/route.h"
 #include "map/route_game_data.h"
 #include "map/site.h"
@@ -514,6 +515,8 @@ QCoro::Task<void> province_game_data::set_owner(const domain *domain)
 		co_return;
 	}
 
+	province_pathfinder::get()->invalidate();
+
 	const metternich::domain *old_owner = this->owner;
 
 	this->owner = domain;
@@ -1050,7 +1053,7 @@ const QPoint &province_game_data::get_territory_rect_center() const
 	return this->province->get_map_data()->get_territory_rect_center();
 }
 
-const std::vector<const metternich::province *> &province_game_data::get_neighbor_provinces() const
+std::span<const metternich::province * const> province_game_data::get_neighbor_provinces() const
 {
 	return this->province->get_map_data()->get_neighbor_provinces();
 }
@@ -1861,11 +1864,11 @@ QCoro::Task<void> province_game_data::add_technology(const technology *technolog
 
 QCoro::Task<void> province_game_data::add_technology_with_prerequisites(const technology *technology)
 {
-	co_await this->add_technology(technology);
-
-	for (const metternich::technology *prerequisite : technology->get_prerequisites()) {
-		co_await this->add_technology_with_prerequisites(prerequisite);
+	for (const metternich::technology *prerequisite : technology->get_all_prerequisites()) {
+		co_await this->add_technology(prerequisite);
 	}
+
+	co_await this->add_technology(technology);
 }
 
 QCoro::Task<void> province_game_data::remove_technology(const technology *technology)
@@ -1917,6 +1920,11 @@ bool province_game_data::can_gain_technology(const technology *technology) const
 
 QCoro::Task<void> province_game_data::on_technology_gained(const technology *technology, const int multiplier)
 {
+	//employment availability depends on technologies
+	for (const site *site : this->get_sites()) {
+		site->get_game_data()->set_employment_dirty();
+	}
+
 	if (technology->get_modifier() != nullptr) {
 		co_await technology->get_modifier()->apply(this->province, multiplier);
 	}
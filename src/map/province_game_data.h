@@ -184,7 +184,7 @@ public:
 
 	const QRect &get_territory_rect() const;
 	const QPoint &get_territory_rect_center() const;
-	const std::vector<const metternich::province *> &get_neighbor_provinces() const;
+	std::span<const metternich::province * const> get_neighbor_provinces() const;
 
 	bool is_country_border_province() const;
 
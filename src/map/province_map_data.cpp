@@ -18,7 +18,6 @@
 #include "util/log_util.h"
 #include "util/point_util.h"
 #include "util/rect_util.h"
-#include "util/vector_util.h"
 
 #include <opencv2/core/core.hpp>
 #include <opencv2/core/mat.hpp>
@@ -44,29 +43,6 @@ void province_map_data::on_map_created()
 {
 	this->initialize_terrain();
 
-	this->nearby_provinces = this->get_neighbor_provinces();
-
-	//add provinces connected by a water zone to the nearby provinces list
-	if (!this->province->is_water_zone()) {
-		for (const metternich::province *neighbor_province : this->get_neighbor_provinces()) {
-			if (!neighbor_province->is_water_zone()) {
-				continue;
-			}
-
-			for (const metternich::province *nearby_province : neighbor_province->get_map_data()->get_neighbor_provinces()) {
-				if (nearby_province->is_water_zone()) {
-					continue;
-				}
-
-				if (nearby_province == this->province || vector::contains(this->nearby_provinces, nearby_province)) {
-					continue;
-				}
-
-				this->nearby_provinces.push_back(nearby_province);
-			}
-		}
-	}
-
 	if (this->province->uses_geopolygons()) {
 		const map_template *map_template = game::get()->get_scenario()->get_map_template();
 		const QSize &map_size = map_template->get_size();
@@ -206,9 +182,16 @@ void province_map_data::calculate_center_tile_pos()
 	assert_throw(map::get()->get_tile(this->get_center_tile_pos())->get_province() == this->province);
 }
 
-void province_map_data::add_neighbor_province(const metternich::province *province)
+void province_map_data::add_border_with(const metternich::province *province)
 {
-	this->neighbor_provinces.push_back(province);
+	for (auto &[border_province, border_length] : this->border_lengths) {
+		if (border_province == province) {
+			++border_length;
+			return;
+		}
+	}
+
+	this->border_lengths.emplace_back(province, 1);
 
 	if (province->is_sea() || province->is_bay()) {
 		this->coastal = true;
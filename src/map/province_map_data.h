@@ -71,18 +71,40 @@ public:
 	void calculate_territory_rect_center();
 	void calculate_center_tile_pos();
 
-	const std::vector<const metternich::province *> &get_neighbor_provinces() const
+	int get_index() const
 	{
-		return this->neighbor_provinces;
+		return this->index;
+	}
+
+	void set_index(const int index)
+	{
+		this->index = index;
 	}
 
-	void add_neighbor_province(const metternich::province *province);
+	std::span<const metternich::province * const> get_neighbor_provinces() const
+	{
+		return this->neighbor_provinces;
+	}
 
-	const std::vector<const metternich::province *> &get_nearby_provinces() const
+	std::span<const metternich::province * const> get_nearby_provinces() const
 	{
 		return this->nearby_provinces;
 	}
 
+	void set_adjacency(const std::span<const metternich::province * const> neighbor_provinces, const std::span<const metternich::province * const> nearby_provinces)
+	{
+		this->neighbor_provinces = neighbor_provinces;
+		this->nearby_provinces = nearby_provinces;
+		this->border_lengths.clear();
+	}
+
+	const std::vector<std::pair<const metternich::province *, int>> &get_border_lengths() const
+	{
+		return this->border_lengths;
+	}
+
+	void add_border_with(const metternich::province *province);
+
 	const std::vector<QPoint> &get_tiles() const
 	{
 		return this->tiles;
@@ -134,8 +156,10 @@ private:
 	bool river = false;
 	QRect territory_rect;
 	QPoint territory_rect_center = QPoint(-1, -1);
-	std::vector<const metternich::province *> neighbor_provinces;
-	std::vector<const metternich::province *> nearby_provinces; //neighbor provinces plus land provinces connected by a water zone
+	int index = -1; //the index in the map's province list, and thus in its province adjacency graph
+	std::span<const metternich::province * const> neighbor_provinces; //points into the map's province adjacency graph
+	std::span<const metternich::province * const> nearby_provinces; //neighbor provinces plus land provinces connected by a water zone
+	std::vector<std::pair<const metternich::province *, int>> border_lengths; //the number of tile adjacencies with each bordering province, gathered while processing border tiles and moved into the adjacency graph when it is created
 	std::vector<QPoint> tiles;
 	std::vector<QPoint> resource_tiles;
 	std::vector<const site *> sites;
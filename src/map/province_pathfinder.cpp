@@ -0,0 +1,274 @@
+#include "metternich.h"
+
+#include "map/province_pathfinder.h"
+
+#include "domain/domain.h"
+#include "domain/domain_diplomacy.h"
+#include "game/game.h"
+#include "map/map.h"
+#include "map/province.h"
+#include "map/province_adjacency_graph.h"
+#include "map/province_game_data.h"
+#include "map/province_map_data.h"
+#include "util/assert_util.h"
+
+namespace metternich {
+
+int province_distance_field::get_distance(const province *province) const
+{
+	const int index = province->get_map_data()->get_index();
+	assert_throw(index != -1);
+
+	return this->distances.at(index);
+}
+
+std::vector<const province *> province_distance_field::get_path(const province *province) const
+{
+	std::vector<const metternich::province *> path;
+
+	int index = province->get_map_data()->get_index();
+	assert_throw(index != -1);
+
+	if (this->distances.at(index) == province_distance_field::unreachable) {
+		return path;
+	}
+
+	path.reserve(this->distances.at(index));
+
+	const std::vector<metternich::province *> &map_provinces = map::get()->get_provinces();
+
+	while (this->distances.at(index) > 0) {
+		index = this->next_indices.at(index);
+		path.push_back(map_provinces.at(index));
+	}
+
+	return path;
+}
+
+const province_distance_field *province_pathfinder::get_distance_field(const metternich::domain *domain, const province_path_mode mode, const std::vector<const province *> &sources)
+{
+	this->clear_if_stale();
+
+	field_key key(domain, mode, province_pathfinder::get_source_indices(sources));
+
+	const auto find_iterator = this->distance_fields.find(key);
+	if (find_iterator != this->distance_fields.end()) {
+		++province_pathfinder::field_hit_count;
+		return find_iterator->second.get();
+	}
+
+	++province_pathfinder::field_miss_count;
+
+	std::unique_ptr<province_distance_field> field = province_pathfinder::calculate_distance_field(map::get()->get_province_adjacency_graph(), this->get_passability_mask(domain, mode), std::get<2>(key));
+	return this->distance_fields.emplace(std::move(key), std::move(field)).first->second.get();
+}
+
+std::vector<const province *> province_pathfinder::find_path(const metternich::domain *domain, const province_path_mode mode, const province *start, const province *goal)
+{
+	//the field is calculated from the goal, so that other paths to the same goal can reuse it
+	return this->get_distance_field(domain, mode, { goal })->get_path(start);
+}
+
+std::vector<std::vector<const province *>> province_pathfinder::find_paths(const std::vector<province_path_query> &queries)
+{
+	this->clear_if_stale();
+
+	std::vector<field_key> query_keys;
+	query_keys.reserve(queries.size());
+
+	std::vector<const field_key *> missing_keys;
+	std::set<field_key> missing_key_set;
+
+	for (const province_path_query &query : queries) {
+		query_keys.emplace_back(query.domain, query.mode, province_pathfinder::get_source_indices({ query.goal }));
+	}
+
+	for (const field_key &key : query_keys) {
+		if (this->distance_fields.contains(key) || missing_key_set.contains(key)) {
+			++province_pathfinder::field_hit_count;
+			continue;
+		}
+
+		++province_pathfinder::field_miss_count;
+		missing_key_set.insert(key);
+		missing_keys.push_back(&key);
+
+		//the masks depend on game state, so they are created here rather than in the worker threads
+		this->get_passability_mask(std::get<0>(key), std::get<1>(key));
+	}
+
+	std::vector<std::unique_ptr<province_distance_field>> missing_fields(missing_keys.size());
+	std::vector<size_t> missing_indices(missing_keys.size());
+	std::iota(missing_indices.begin(), missing_indices.end(), 0);
+
+	const province_adjacency_graph *graph = map::get()->get_province_adjacency_graph();
+
+	//calculating a field only reads the adjacency graph and the passability mask, so the fields can be calculated concurrently
+	QtConcurrent::blockingMap(missing_indices, [this, graph, &missing_keys, &missing_fields](const size_t &index) {
+		const field_key &key = *missing_keys[index];
+		const std::vector<province_passability> &passability_mask = this->passability_masks.find(std::make_pair(std::get<0>(key), std::get<1>(key)))->second;
+		missing_fields[index] = province_pathfinder::calculate_distance_field(graph, passability_mask, std::get<2>(key));
+	});
+
+	for (size_t i = 0; i < missing_keys.size(); ++i) {
+		this->distance_fields.emplace(*missing_keys[i], std::move(missing_fields[i]));
+	}
+
+	std::vector<std::vector<const province *>> paths;
+	paths.reserve(queries.size());
+
+	for (size_t i = 0; i < queries.size(); ++i) {
+		paths.push_back(this->distance_fields.find(query_keys[i])->second->get_path(queries[i].start));
+	}
+
+	return paths;
+}
+
+void province_pathfinder::invalidate()
+{
+	this->passability_masks.clear();
+	this->distance_fields.clear();
+}
+
+void province_pathfinder::clear_if_stale()
+{
+	if (this->cache_turn == game::get()->get_turn()) {
+		return;
+	}
+
+	this->invalidate();
+	this->cache_turn = game::get()->get_turn();
+}
+
+const std::vector<province_passability> &province_pathfinder::get_passability_mask(const metternich::domain *domain, const province_path_mode mode)
+{
+	const std::pair<const metternich::domain *, province_path_mode> key(domain, mode);
+
+	const auto find_iterator = this->passability_masks.find(key);
+	if (find_iterator != this->passability_masks.end()) {
+		return find_iterator->second;
+	}
+
+	const std::vector<province *> &map_provinces = map::get()->get_provinces();
+
+	std::vector<province_passability> passability_mask(map_provinces.size(), province_passability::impassable);
+	for (size_t i = 0; i < map_provinces.size(); ++i) {
+		passability_mask[i] = province_pathfinder::get_passability(map_provinces[i], domain, mode);
+	}
+
+	return this->passability_masks.emplace(key, std::move(passability_mask)).first->second;
+}
+
+province_passability province_pathfinder::get_passability(const province *province, const metternich::domain *domain, const province_path_mode mode)
+{
+	if (province->is_water_zone()) {
+		//water zones are never owned by countries
+		switch (mode) {
+			case province_path_mode::military_water:
+			case province_path_mode::military_air:
+				return province_passability::passable;
+			case province_path_mode::military_land:
+			case province_path_mode::civilian:
+				return province_passability::impassable;
+			default:
+				assert_throw(false);
+		}
+	}
+
+	const metternich::domain *province_owner = province->get_game_data()->get_owner();
+	if (province_owner == nullptr) {
+		return province_passability::impassable;
+	}
+
+	if (province_owner != domain && !province_owner->get_diplomacy()->is_any_vassal_of(domain)) {
+		if (mode == province_path_mode::civilian) {
+			return province_passability::impassable;
+		}
+
+		if (!domain->get_diplomacy()->can_attack(province_owner)) {
+			return province_passability::impassable;
+		}
+	}
+
+	if (mode == province_path_mode::military_water) {
+		//ships can move from water to land provinces, but not through them
+		return province_passability::endpoint;
+	}
+
+	return province_passability::passable;
+}
+
+std::vector<int> province_pathfinder::get_source_indices(const std::vector<const province *> &sources)
+{
+	std::vector<int> source_indices;
+	source_indices.reserve(sources.size());
+
+	for (const province *source : sources) {
+		const int index = source->get_map_data()->get_index();
+		assert_throw(index != -1);
+		source_indices.push_back(index);
+	}
+
+	std::sort(source_indices.begin(), source_indices.end());
+	source_indices.erase(std::unique(source_indices.begin(), source_indices.end()), source_indices.end());
+
+	return source_indices;
+}
+
+std::unique_ptr<province_distance_field> province_pathfinder::calculate_distance_field(const province_adjacency_graph *graph, const std::vector<province_passability> &passability_mask, const std::vector<int> &source_indices)
+{
+	assert_throw(graph != nullptr);
+	assert_throw(passability_mask.size() == graph->get_province_count());
+
+	auto field = std::make_unique<province_distance_field>(graph->get_province_count());
+
+	//every move has the same cost, so a breadth-first search from all sources at once gives the distance to the nearest one
+	std::vector<int> queue;
+	queue.reserve(graph->get_province_count());
+
+	for (const int source_index : source_indices) {
+		//an impassable source cannot be reached from anywhere
+		if (passability_mask[source_index] == province_passability::impassable) {
+			continue;
+		}
+
+		field->distances[source_index] = 0;
+		queue.push_back(source_index);
+	}
+
+	for (size_t i = 0; i < queue.size(); ++i) {
+		const int index = queue[i];
+		const bool is_endpoint = passability_mask[index] == province_passability::endpoint;
+
+		//endpoint provinces can be where a path starts or ends, but paths cannot go through them
+		if (is_endpoint && field->distances[index] > 0) {
+			continue;
+		}
+
+		for (const province *neighbor_province : graph->get_neighbor_provinces(index)) {
+			const int neighbor_index = neighbor_province->get_map_data()->get_index();
+
+			if (field->distances[neighbor_index] != province_distance_field::unreachable) {
+				continue;
+			}
+
+			const province_passability neighbor_passability = passability_mask[neighbor_index];
+			if (neighbor_passability == province_passability::impassable) {
+				continue;
+			}
+
+			//a path cannot consist of a single move between two endpoint provinces, e.g. a ship moving from one land province to another
+			if (is_endpoint && neighbor_passability == province_passability::endpoint) {
+				continue;
+			}
+
+			field->distances[neighbor_index] = field->distances[index] + 1;
+			field->next_indices[neighbor_index] = index;
+			queue.push_back(neighbor_index);
+		}
+	}
+
+	return field;
+}
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "util/singleton.h"
+
+namespace metternich {
+
+class domain;
+class province;
+class province_adjacency_graph;
+
+//the movement rules a path must follow, mirroring the can_move_to checks of units
+enum class province_path_mode {
+	military_land, //land provinces owned by the domain, by its vassals, or by domains it can attack
+	military_water, //water zones; land provinces which land movement could enter can only be the start or the end of a path, and a path cannot move directly between two of them
+	military_air, //water zones, and land provinces as for land movement
+	civilian //land provinces owned by the domain or by its vassals
+};
+
+//how a province can be part of a path for a given domain and path mode; provinces which are impassable can neither be passed through, nor be the start or end of a path
+enum class province_passability : uint8_t {
+	impassable,
+	endpoint, //can only be the start or the end of a path
+	passable
+};
+
+//the distances of every province on the map to the nearest of a set of source provinces, together with the next step towards it
+class province_distance_field final
+{
+public:
+	static constexpr int unreachable = -1;
+
+	explicit province_distance_field(const size_t province_count)
+		: distances(province_count, province_distance_field::unreachable), next_indices(province_count, -1)
+	{
+	}
+
+	int get_distance(const province *province) const;
+
+	int get_distance(const size_t province_index) const
+	{
+		return this->distances.at(province_index);
+	}
+
+	//the index of the next province on the path to the nearest source, or -1 if the province is a source or cannot reach one
+	int get_next_index(const size_t province_index) const
+	{
+		return this->next_indices.at(province_index);
+	}
+
+	//the path from the province to the nearest source, excluding the province itself; empty if no source can be reached, if the province is a source, or if the province or the sources are impassable
+	std::vector<const province *> get_path(const province *province) const;
+
+private:
+	std::vector<int> distances;
+	std::vector<int> next_indices;
+
+	friend class province_pathfinder;
+};
+
+struct province_path_query final
+{
+	const metternich::domain *domain = nullptr;
+	province_path_mode mode = province_path_mode::military_land;
+	const province *start = nullptr;
+	const province *goal = nullptr;
+};
+
+//shortest paths over the province adjacency graph, where each move to a neighboring province has the same cost
+//distance fields are cached per domain, path mode and set of sources; they are invalidated when the turn changes, and when province ownership or diplomatic relations change
+class province_pathfinder final : public singleton<province_pathfinder>
+{
+public:
+	static int64_t get_field_hit_count()
+	{
+		return province_pathfinder::field_hit_count;
+	}
+
+	static int64_t get_field_miss_count()
+	{
+		return province_pathfinder::field_miss_count;
+	}
+
+	//calculates the distances of all provinces in the graph to the nearest of the sources, moving only through provinces passable according to the mask, which is indexed as the graph
+	static std::unique_ptr<province_distance_field> calculate_distance_field(const province_adjacency_graph *graph, const std::vector<province_passability> &passability_mask, const std::vector<int> &source_indices);
+
+	const province_distance_field *get_distance_field(const metternich::domain *domain, const province_path_mode mode, const std::vector<const province *> &sources);
+
+	std::vector<const province *> find_path(const metternich::domain *domain, const province_path_mode mode, const province *start, const province *goal);
+
+	//routes all the queries in one pass: queries sharing a domain, mode and goal share the same distance field, and missing fields are calculated concurrently
+	std::vector<std::vector<const province *>> find_paths(const std::vector<province_path_query> &queries);
+
+	void invalidate();
+
+private:
+	using field_key = std::tuple<const metternich::domain *, province_path_mode, std::vector<int>>;
+
+	void clear_if_stale();
+	const std::vector<province_passability> &get_passability_mask(const metternich::domain *domain, const province_path_mode mode);
+	static province_passability get_passability(const province *province, const metternich::domain *domain, const province_path_mode mode);
+	static std::vector<int> get_source_indices(const std::vector<const province *> &sources);
+
+private:
+	static inline std::atomic<int64_t> field_hit_count = 0;
+	static inline std::atomic<int64_t> field_miss_count = 0;
+
+	int cache_turn = 0;
+	std::map<std::pair<const metternich::domain *, province_path_mode>, std::vector<province_passability>> passability_masks;
+	std::map<field_key, std::unique_ptr<province_distance_field>> distance_fields;
+};
+
+}
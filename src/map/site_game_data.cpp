@@ -22,6 +22,7 @@
 #include "economy/income_transaction_type.h"
 #include "economy/resource.h"
 #include "engine_interface.h"
+#include "game/change_notifier.h"
 #include "game/domain_event.h"
 #include "game/event_trigger.h"
 #include "game/game.h"
@@ -62,6 +63,7 @@
 #include "script/factor.h"
 #include "script/modifier.h"
 #include "script/scripted_site_modifier.h"
+#include "ui/object_list_model.h"
 #include "ui/portrait.h"
 #include "ui/ui_defines.h"
 #include "unit/army.h"
@@ -77,6 +79,7 @@ namespace metternich {
 
 site_game_data::site_game_data(const metternich::site *site) : site(site)
 {
+	this->population_unit_model = make_qunique<object_list_model>();
 }
 
 void site_game_data::process_gsml_property(const gsml_property &property)
@@ -189,7 +192,7 @@ void site_game_data::process_gsml_scope(const gsml_data &scope)
 		});
 	} else if (tag == "homed_characters") {
 		for (const std::string &value : values) {
-			this->homed_characters.push_back(game::get()->get_character(value));
+			this->add_homed_character(game::get()->get_character(value));
 		}
 	} else {
 		throw std::runtime_error(std::format("Invalid site game data scope: \"{}\".", tag));
@@ -414,6 +417,7 @@ QCoro::Task<void> site_game_data::initialize()
 QCoro::Task<void> site_game_data::do_turn()
 {
 	co_await this->decrement_scripted_modifiers();
+	co_await this->compact_population_units();
 }
 
 QCoro::Task<void> site_game_data::do_events()
@@ -663,6 +667,8 @@ QCoro::Task<void> site_game_data::set_owner(const domain *owner)
 		co_return;
 	}
 
+	this->set_employment_dirty();
+
 	const domain *old_owner = this->get_owner();
 
 	if (old_owner != nullptr) {
@@ -763,7 +769,7 @@ QCoro::Task<void> site_game_data::set_owner(const domain *owner)
 	}
 
 	if (game::get()->is_running()) {
-		emit owner_changed();
+		change_notifier::get()->notify(this, &site_game_data::owner_changed);
 	}
 }
 
@@ -924,7 +930,7 @@ QCoro::Task<void> site_game_data::set_holding_type(const metternich::holding_typ
 	}
 
 	if (game::get()->is_running()) {
-		emit holding_type_changed();
+		change_notifier::get()->notify(this, &site_game_data::holding_type_changed);
 		emit map::get()->tile_holding_type_changed(this->get_tile_pos());
 	}
 }
@@ -1035,7 +1041,7 @@ void site_game_data::set_holding_level(const centesimal_int &level)
 	}
 
 	if (game::get()->is_running()) {
-		emit holding_level_changed();
+		change_notifier::get()->notify(this, &site_game_data::holding_level_changed);
 	}
 }
 
@@ -1131,7 +1137,7 @@ void site_game_data::set_weighted_holding_level(const centesimal_int &level)
 	}
 
 	if (game::get()->is_running()) {
-		emit weighted_holding_level_changed();
+		change_notifier::get()->notify(this, &site_game_data::weighted_holding_level_changed);
 	}
 }
 
@@ -1168,7 +1174,7 @@ void site_game_data::set_fortification_level(const centesimal_int &level)
 	this->fortification_level = level;
 
 	if (game::get()->is_running()) {
-		emit fortification_level_changed();
+		change_notifier::get()->notify(this, &site_game_data::fortification_level_changed);
 	}
 }
 
@@ -1256,7 +1262,7 @@ QCoro::Task<void> site_game_data::set_dungeon(const metternich::dungeon *dungeon
 	}
 
 	if (game::get()->is_running()) {
-		emit dungeon_changed();
+		change_notifier::get()->notify(this, &site_game_data::dungeon_changed);
 
 		if (this->get_province() != nullptr) {
 			emit this->get_province()->get_game_data()->dungeon_sites_changed();
@@ -1351,7 +1357,7 @@ QCoro::Task<void> site_game_data::add_feature(const site_feature *feature)
 	this->get_province()->get_game_data()->change_site_feature_count(feature, 1);
 
 	if (game::get()->is_running()) {
-		emit features_changed();
+		change_notifier::get()->notify(this, &site_game_data::features_changed);
 	}
 }
 
@@ -1372,7 +1378,7 @@ QCoro::Task<void> site_game_data::remove_feature(const site_feature *feature)
 	this->get_province()->get_game_data()->change_site_feature_count(feature, -1);
 
 	if (game::get()->is_running()) {
-		emit features_changed();
+		change_notifier::get()->notify(this, &site_game_data::features_changed);
 	}
 }
 
@@ -1448,7 +1454,7 @@ QCoro::Task<void> site_game_data::change_attribute_value(const site_attribute *a
 	}
 
 	if (game::get()->is_running()) {
-		emit attribute_values_changed();
+		change_notifier::get()->notify(this, &site_game_data::attribute_values_changed);
 	}
 }
 
@@ -2064,7 +2070,7 @@ QCoro::Task<void> site_game_data::add_scripted_modifier(const scripted_site_modi
 	}
 
 	if (game::get()->is_running()) {
-		emit scripted_modifiers_changed();
+		change_notifier::get()->notify(this, &site_game_data::scripted_modifiers_changed);
 	}
 }
 
@@ -2077,7 +2083,7 @@ QCoro::Task<void> site_game_data::remove_scripted_modifier(const scripted_site_m
 	}
 
 	if (game::get()->is_running()) {
-		emit scripted_modifiers_changed();
+		change_notifier::get()->notify(this, &site_game_data::scripted_modifiers_changed);
 	}
 }
 
@@ -2131,6 +2137,7 @@ QCoro::Task<void> site_game_data::add_population_unit(qunique_ptr<population_uni
 		co_await this->change_employment_size(population_unit->get_employment_type(), population_unit->get_size(), change_input_storage);
 	}
 
+	this->population_unit_model->add_object(population_unit.get());
 	this->population_units.push_back(std::move(population_unit));
 
 	if (this->is_capital()) {
@@ -2149,6 +2156,7 @@ QCoro::Task<qunique_ptr<population_unit>> site_game_data::pop_population_unit(po
 		if (this->population_units[i].get() == population_unit) {
 			qunique_ptr<metternich::population_unit> population_unit_unique_ptr = std::move(this->population_units[i]);
 			this->population_units.erase(this->population_units.begin() + i);
+			this->population_unit_model->remove_object(population_unit);
 
 			if (population_unit->get_employment_type() != nullptr) {
 				co_await this->change_employment_size(population_unit->get_employment_type(), -population_unit->get_size(), change_input_storage);
@@ -2179,8 +2187,49 @@ QCoro::Task<qunique_ptr<population_unit>> site_game_data::pop_population_unit(po
 	co_return nullptr;
 }
 
+QCoro::Task<void> site_game_data::compact_population_units()
+{
+	if (this->population_units.size() < 2) {
+		co_return;
+	}
+
+	//merge population units which have the same type, culture, religion, phenotype and employment type, as changes applied directly to units (e.g. cultural change or promotion) can otherwise leave several of them around for the same combination
+	using population_unit_key = std::tuple<const population_type *, const metternich::culture *, const metternich::religion *, const phenotype *, const employment_type *>;
+	std::map<population_unit_key, population_unit *> population_units_by_key;
+	std::vector<std::pair<population_unit *, population_unit *>> merges;
+
+	for (const auto &population_unit : this->population_units) {
+		const population_unit_key key(population_unit->get_type(), population_unit->get_culture(), population_unit->get_religion(), population_unit->get_phenotype(), population_unit->get_employment_type());
+
+		const auto [find_iterator, inserted] = population_units_by_key.try_emplace(key, population_unit.get());
+		if (!inserted) {
+			merges.emplace_back(population_unit.get(), find_iterator->second);
+		}
+	}
+
+	for (const auto &[merged_population_unit, target_population_unit] : merges) {
+		const int64_t merged_size = merged_population_unit->get_size();
+		const int64_t target_size = target_population_unit->get_size();
+		const int64_t total_size = merged_size + target_size;
+
+		if (total_size > 0) {
+			target_population_unit->set_literacy_rate(((merged_population_unit->get_literacy_rate() * merged_size) + (target_population_unit->get_literacy_rate() * target_size)) / total_size);
+			target_population_unit->set_fulfilled_life_needs_percent(static_cast<int>((merged_population_unit->get_fulfilled_life_needs_percent() * merged_size + target_population_unit->get_fulfilled_life_needs_percent() * target_size) / total_size));
+			target_population_unit->set_fulfilled_everyday_needs_percent(static_cast<int>((merged_population_unit->get_fulfilled_everyday_needs_percent() * merged_size + target_population_unit->get_fulfilled_everyday_needs_percent() * target_size) / total_size));
+			target_population_unit->set_fulfilled_luxury_needs_percent(static_cast<int>((merged_population_unit->get_fulfilled_luxury_needs_percent() * merged_size + target_population_unit->get_fulfilled_luxury_needs_percent() * target_size) / total_size));
+		}
+
+		target_population_unit->change_wealth(merged_population_unit->get_wealth());
+
+		//the merged unit is removed before the target is grown, so that the employment size never exceeds the capacity; the employment size is the same afterwards, so input storage doesn't need to change
+		co_await this->pop_population_unit(merged_population_unit, false);
+		co_await target_population_unit->change_size(merged_size, false);
+	}
+}
+
 void site_game_data::clear_population_units()
 {
+	this->population_unit_model->clear();
 	this->population_units.clear();
 }
 
@@ -2224,6 +2273,8 @@ QCoro::Task<void> site_game_data::change_population(const population_type *type,
 
 void site_game_data::on_population_type_size_changed(const population_type *population_type, const int64_t change)
 {
+	this->set_employment_dirty();
+
 	if (population_type->get_output_commodity() != nullptr) {
 		const int64_t new_population_type_size = this->get_population()->get_type_size(population_type);
 		const int64_t old_population_type_size = new_population_type_size - change;
@@ -2262,7 +2313,7 @@ void site_game_data::set_population_capacity(const int64_t capacity)
 	this->population_capacity = capacity;
 
 	if (game::get()->is_running()) {
-		emit population_capacity_changed();
+		change_notifier::get()->notify(this, &site_game_data::population_capacity_changed);
 	}
 }
 
@@ -2379,6 +2430,8 @@ void site_game_data::set_employment_capacity(const employment_type *employment_t
 	} else {
 		this->employment_capacities[employment_type] = capacity;
 	}
+
+	this->set_employment_dirty();
 }
 
 void site_game_data::calculate_employment_capacity(const employment_type *employment_type)
@@ -2496,6 +2549,37 @@ QCoro::Task<void> site_game_data::check_employment()
 			}
 		}
 	}
+
+	//the population changes made while checking employment have been accounted for
+	this->employment_dirty = false;
+}
+
+bool site_game_data::needs_employment_check() const
+{
+	if (this->is_employment_dirty()) {
+		return true;
+	}
+
+	//the employment input capacity depends on the owner's stored commodities, which change every turn, so unemployed population may find employment even if nothing else changed
+	bool has_available_employment_capacity = false;
+	for (const auto &[employment_type, employment_capacity] : this->get_employment_capacities()) {
+		if (this->get_available_employment_capacity(employment_type) > 0) {
+			has_available_employment_capacity = true;
+			break;
+		}
+	}
+
+	if (!has_available_employment_capacity) {
+		return false;
+	}
+
+	for (const auto &population_unit : this->get_population_units()) {
+		if (population_unit->get_employment_type() == nullptr) {
+			return true;
+		}
+	}
+
+	return false;
 }
 
 QCoro::Task<void> site_game_data::check_employment_capacities_overflow()
@@ -2575,7 +2659,7 @@ void site_game_data::set_commodity_output(const commodity *commodity, const cent
 		}
 	}
 
-	emit commodity_outputs_changed();
+	change_notifier::get()->notify(this, &site_game_data::commodity_outputs_changed);
 }
 
 void site_game_data::calculate_commodity_outputs()
@@ -2893,6 +2977,13 @@ int site_game_data::get_skill_modifier(const skill *skill) const
 	return modifier;
 }
 
+void site_game_data::add_homed_character(const character *character)
+{
+	this->homed_characters.push_back(character);
+
+	game::get()->add_homed_character(character);
+}
+
 bool site_game_data::is_accessible_for_character(const character *character) const
 {
 	const metternich::site *character_location = character->get_game_data()->get_location();
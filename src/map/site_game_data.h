@@ -15,6 +15,7 @@ Q_MOC_INCLUDE("infrastructure/holding_type.h")
 Q_MOC_INCLUDE("map/province.h")
 Q_MOC_INCLUDE("population/population.h")
 Q_MOC_INCLUDE("religion/religion.h")
+Q_MOC_INCLUDE("ui/object_list_model.h")
 
 namespace archimedes {
 	class dice;
@@ -35,6 +36,7 @@ class domain;
 class dungeon;
 class employment_type;
 class holding_type;
+class object_list_model;
 class party;
 class pathway;
 class phenotype;
@@ -81,6 +83,7 @@ class site_game_data final : public QObject
 	Q_PROPERTY(metternich::population* population READ get_population CONSTANT)
 	Q_PROPERTY(QVariantList population_units READ get_population_units_qvariant_list NOTIFY population_units_changed)
 	Q_PROPERTY(int population_unit_count READ get_population_unit_count NOTIFY population_units_changed)
+	Q_PROPERTY(metternich::object_list_model* population_unit_model READ get_population_unit_model CONSTANT)
 	Q_PROPERTY(qint64 population_capacity READ get_population_capacity NOTIFY population_capacity_changed)
 	Q_PROPERTY(QVariantList commodity_outputs READ get_commodity_outputs_qvariant_list NOTIFY commodity_outputs_changed)
 	Q_PROPERTY(QVariantList visiting_armies READ get_visiting_armies_qvariant_list NOTIFY visiting_armies_changed)
@@ -376,8 +379,14 @@ public:
 		return static_cast<int>(this->get_population_units().size());
 	}
 
+	object_list_model *get_population_unit_model() const
+	{
+		return this->population_unit_model.get();
+	}
+
 	[[nodiscard]] QCoro::Task<void> add_population_unit(qunique_ptr<population_unit> &&population_unit, const bool change_input_storage);
 	[[nodiscard]] QCoro::Task<qunique_ptr<population_unit>> pop_population_unit(population_unit *population_unit, const bool change_input_storage);
+	[[nodiscard]] QCoro::Task<void> compact_population_units();
 	void clear_population_units();
 	[[nodiscard]] QCoro::Task<void> create_population_unit(const population_type *type, const metternich::culture *culture, const metternich::religion *religion, const phenotype *phenotype, const employment_type *employment_type, const int64_t size, const decimillesimal_int &literacy_rate, const int64_t wealth, const bool change_input_storage);
 	[[nodiscard]] QCoro::Task<void> change_population(const population_type *type, const metternich::culture *culture, const metternich::religion *religion, const phenotype *phenotype, const employment_type *employment_type, const int64_t size_change, const decimillesimal_int &literacy_rate, const int64_t wealth, const bool change_input_storage);
@@ -489,6 +498,18 @@ public:
 	[[nodiscard]] QCoro::Task<void> check_employment();
 	[[nodiscard]] QCoro::Task<void> check_employment_capacities_overflow();
 
+	bool is_employment_dirty() const
+	{
+		return this->employment_dirty;
+	}
+
+	void set_employment_dirty()
+	{
+		this->employment_dirty = true;
+	}
+
+	bool needs_employment_check() const;
+
 	int get_free_food_consumption() const
 	{
 		return this->free_food_consumption;
@@ -659,10 +680,7 @@ public:
 		return this->homed_characters;
 	}
 
-	void add_homed_character(const character *character)
-	{
-		this->homed_characters.push_back(character);
-	}
+	void add_homed_character(const character *character);
 
 	bool is_accessible_for_character(const character *character) const;
 	bool is_accessible_for_domain(const domain *domain) const;
@@ -710,12 +728,14 @@ private:
 	building_slot_type_map<building_slot *> building_slot_map;
 	scripted_site_modifier_map<int> scripted_modifiers;
 	std::vector<qunique_ptr<population_unit>> population_units;
+	qunique_ptr<object_list_model> population_unit_model;
 	qunique_ptr<metternich::population> population;
 	int64_t population_capacity = 0;
 	data_entry_map<employment_type, int64_t> employment_sizes;
 	data_entry_map<employment_type, int64_t> base_employment_capacities;
 	data_entry_map<employment_type, int64_t> employment_capacity_modifiers;
 	data_entry_map<employment_type, int64_t> employment_capacities;
+	bool employment_dirty = true; //whether population, employment capacities or employment availability changed since employment was last checked
 	int free_food_consumption = 0;
 	commodity_map<centesimal_int> base_commodity_outputs;
 	commodity_map<centesimal_int> commodity_outputs;
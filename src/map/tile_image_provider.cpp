@@ -8,13 +8,13 @@
 #include "infrastructure/pathway.h"
 #include "map/celestial_body_type.h"
 #include "map/terrain_type.h"
+#include "ui/image_scaling.h"
+#include "ui/scaled_image_cache.h"
 #include "util/assert_util.h"
 #include "util/image_util.h"
 #include "util/path_util.h"
 #include "util/string_util.h"
 
-#include "xbrz.h"
-
 namespace metternich {
 
 tile_image_provider::tile_image_provider()
@@ -105,19 +105,29 @@ QCoro::Task<void> tile_image_provider::load_image(const std::string id)
 		}
 	}
 
-	QImage image = QImage(path::to_qstring(filepath));
+	const QSize frame_size = is_subtile_image ? defines::get()->get_tile_size() / 2 : defines::get()->get_tile_size();
 
-	assert_throw(!image.isNull());
+	const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
+	std::string cache_key;
+	QImage image;
 
-	const QSize frame_size = is_subtile_image ? defines::get()->get_tile_size() / 2 : defines::get()->get_tile_size();
+	if (image_scale_factor != scale_factor && scaling_algorithm_enabled) {
+		cache_key = scaled_image_cache::get()->build_key(filepath, scale_factor, std::format("{}x{}", frame_size.width(), frame_size.height()));
+		image = scaled_image_cache::get()->load_image(cache_key);
+	}
+
+	const bool is_cached = !image.isNull();
+
+	if (!is_cached) {
+		image = QImage(path::to_qstring(filepath));
+		assert_throw(!image.isNull());
+	}
 
-	if (image_scale_factor != scale_factor) {
-		const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
-		co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, frame_size, scaling_algorithm_enabled]() {
+	if (image_scale_factor != scale_factor && !is_cached) {
+		co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, frame_size, scaling_algorithm_enabled, &cache_key]() {
 			if (scaling_algorithm_enabled) {
-				image = image::scale<QImage::Format_ARGB32>(image, scale_factor / image_scale_factor, frame_size * image_scale_factor, [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-					xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-				});
+				image = image_scaling::scale(image, scale_factor / image_scale_factor, frame_size * image_scale_factor);
+				scaled_image_cache::get()->save_image(cache_key, image);
 			} else {
 				image = image.scaled(image.size() * scale_factor);
 			}
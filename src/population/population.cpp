@@ -4,6 +4,7 @@
 
 #include "culture/culture.h"
 #include "database/defines.h"
+#include "game/change_notifier.h"
 #include "game/game.h"
 #include "population/population_type.h"
 #include "population/population_unit.h"
@@ -28,7 +29,7 @@ void population::change_population_unit_count(const int change)
 	}
 
 	if (game::get()->is_running()) {
-		emit population_unit_count_changed();
+		change_notifier::get()->notify(this, &population::population_unit_count_changed);
 	}
 }
 
@@ -47,7 +48,7 @@ void population::change_size(const int64_t change)
 	}
 
 	if (game::get()->is_running()) {
-		emit size_changed();
+		change_notifier::get()->notify(this, &population::size_changed);
 	}
 }
 
@@ -75,7 +76,7 @@ void population::change_type_size(const population_type *type, const int64_t cha
 	}
 
 	if (game::get()->is_running()) {
-		emit type_sizes_changed();
+		change_notifier::get()->notify(this, &population::type_sizes_changed);
 	}
 
 	emit type_size_changed(type, change);
@@ -121,7 +122,7 @@ void population::change_culture_size(const culture *culture, const int64_t chang
 	this->calculate_main_culture();
 
 	if (game::get()->is_running()) {
-		emit culture_sizes_changed();
+		change_notifier::get()->notify(this, &population::culture_sizes_changed);
 	}
 }
 
@@ -155,7 +156,7 @@ void population::change_religion_size(const metternich::religion *religion, cons
 	this->calculate_main_religion();
 
 	if (game::get()->is_running()) {
-		emit religion_sizes_changed();
+		change_notifier::get()->notify(this, &population::religion_sizes_changed);
 	}
 }
 
@@ -183,7 +184,7 @@ void population::change_phenotype_size(const phenotype *phenotype, const int64_t
 	}
 
 	if (game::get()->is_running()) {
-		emit phenotype_sizes_changed();
+		change_notifier::get()->notify(this, &population::phenotype_sizes_changed);
 	}
 }
 
@@ -216,7 +217,7 @@ void population::change_literate_size(const int64_t change)
 	}
 
 	if (game::get()->is_running()) {
-		emit literate_size_changed();
+		change_notifier::get()->notify(this, &population::literate_size_changed);
 	}
 }
 
@@ -8,6 +8,7 @@
 #include "domain/domain_game_data.h"
 #include "economy/commodity.h"
 #include "economy/employment_type.h"
+#include "game/change_notifier.h"
 #include "game/game.h"
 #include "map/province.h"
 #include "map/province_game_data.h"
@@ -87,11 +88,13 @@ QCoro::Task<void> population_unit::do_cultural_change()
 
 QCoro::Task<void> population_unit::do_promotion()
 {
-	co_await this->do_promotion(false);
-	co_await this->do_promotion(true);
+	//the demotion check calculates the promotion factors again, so they are memoized until the population actually changes
+	std::optional<factor_memo_scope> memo_scope(std::in_place);
+	co_await this->do_promotion(false, memo_scope);
+	co_await this->do_promotion(true, memo_scope);
 }
 
-QCoro::Task<void> population_unit::do_promotion(const bool is_demotion)
+QCoro::Task<void> population_unit::do_promotion(const bool is_demotion, std::optional<factor_memo_scope> &memo_scope)
 {
 	assert_throw(this->get_site()->get_game_data()->get_population()->get_size() > 0);
 	assert_throw(this->get_province()->get_game_data()->get_population()->get_size() > 0);
@@ -144,6 +147,8 @@ QCoro::Task<void> population_unit::do_promotion(const bool is_demotion)
 		co_return;
 	}
 
+	memo_scope.reset();
+
 	const int64_t promoted_size = (this->get_size() * promotion_rate / 100).to_int64();
 	const int64_t lost_wealth = this->get_wealth() * promoted_size / this->get_size();
 
@@ -337,7 +342,7 @@ void population_unit::set_site(const metternich::site *site)
 		co_await this->get_site()->get_game_data()->change_employment_size(this->get_employment_type(), this->get_size(), change_input_storage);
 	}
 
-	emit size_changed();
+	change_notifier::get()->notify(this, &population_unit::size_changed);
 }
 
 int64_t population_unit::get_literate_size() const
@@ -367,7 +372,7 @@ void population_unit::set_literacy_rate(const decimillesimal_int &literacy_rate)
 
 	this->get_site()->get_game_data()->get_population()->change_literate_size(this->get_literate_size());
 
-	emit literacy_rate_changed();
+	change_notifier::get()->notify(this, &population_unit::literacy_rate_changed);
 }
 
 void population_unit::set_wealth(const int64_t wealth)
@@ -380,7 +385,7 @@ void population_unit::set_wealth(const int64_t wealth)
 
 	this->wealth = wealth;
 
-	emit wealth_changed();
+	change_notifier::get()->notify(this, &population_unit::wealth_changed);
 }
 
 bool population_unit::is_food_producer() const
@@ -18,6 +18,7 @@ namespace metternich {
 class culture;
 class domain;
 class employment_type;
+class factor_memo_scope;
 class icon;
 class phenotype;
 class population_type;
@@ -50,7 +51,7 @@ public:
 
 	[[nodiscard]] QCoro::Task<void> do_cultural_change();
 	[[nodiscard]] QCoro::Task<void> do_promotion();
-	[[nodiscard]] QCoro::Task<void> do_promotion(const bool is_demotion);
+	[[nodiscard]] QCoro::Task<void> do_promotion(const bool is_demotion, std::optional<factor_memo_scope> &memo_scope);
 
 	std::string get_scope_name() const;
 
@@ -2,8 +2,69 @@
 
 #include "script/condition/and_condition.h"
 
+#include "script/condition/scripted_condition_condition.h"
+#include "util/assert_util.h"
+
 namespace metternich {
 
+namespace {
+
+thread_local int condition_tree_check_depth = 0;
+
+}
+
+bool condition_tree_check_scope::is_active()
+{
+	return condition_tree_check_depth > 0;
+}
+
+condition_tree_check_scope::condition_tree_check_scope()
+{
+	++condition_tree_check_depth;
+}
+
+condition_tree_check_scope::~condition_tree_check_scope()
+{
+	--condition_tree_check_depth;
+}
+
+template <typename scope_type>
+void and_condition<scope_type>::compile() const
+{
+	this->compiled_conditions.clear();
+
+	for (const condition_base_type *condition : this->child_conditions) {
+		this->add_compiled_condition(condition);
+	}
+
+	this->compiled = true;
+}
+
+template <typename scope_type>
+void and_condition<scope_type>::add_compiled_condition(const condition_base_type *condition) const
+{
+	assert_throw(condition != nullptr);
+
+	if (condition->get_condition_operator() == gsml_operator::assignment) {
+		//a nested "and" condition is true only if all of its own conditions are, so they can be checked in its place
+		const and_condition<scope_type> *nested_and_condition = dynamic_cast<const and_condition<scope_type> *>(condition);
+		if (nested_and_condition != nullptr) {
+			for (const condition_base_type *nested_condition : nested_and_condition->get_child_conditions()) {
+				this->add_compiled_condition(nested_condition);
+			}
+			return;
+		}
+
+		const scripted_condition_condition<scope_type> *scripted_condition = dynamic_cast<const scripted_condition_condition<scope_type> *>(condition);
+		if (scripted_condition != nullptr) {
+			this->add_compiled_condition(scripted_condition->get_scripted_condition()->get_conditions());
+			return;
+		}
+	}
+
+	this->compiled_conditions.push_back(condition);
+}
+
 template class and_condition<character>;
 template class and_condition<domain>;
 template class and_condition<military_unit>;
@@ -12,23 +12,116 @@ class military_unit;
 class province;
 class site;
 
+//while a tree check scope is active, "and" conditions walk their condition tree instead of their compiled sequence, including those nested in other conditions and in scripted conditions
+class condition_tree_check_scope final
+{
+public:
+	static bool is_active();
+
+	condition_tree_check_scope();
+	~condition_tree_check_scope();
+
+	condition_tree_check_scope(const condition_tree_check_scope &other) = delete;
+	condition_tree_check_scope &operator =(const condition_tree_check_scope &other) = delete;
+};
+
 template <typename scope_type>
 class and_condition final : public and_condition_base<scope_type, read_only_context, condition<scope_type>>
 {
 public:
+	using condition_base_type = condition_base<scope_type, read_only_context>;
+	using base_type = and_condition_base<scope_type, read_only_context, condition<scope_type>>;
+
 	and_condition()
 	{
 	}
 
 	explicit and_condition(const gsml_operator condition_operator)
-		: and_condition_base<scope_type, read_only_context, condition<scope_type>>(condition_operator)
+		: base_type(condition_operator)
+	{
+	}
+
+	explicit and_condition(std::vector<std::unique_ptr<const condition_base_type>> &&conditions)
+	{
+		for (std::unique_ptr<const condition_base_type> &condition : conditions) {
+			this->add_condition(std::move(condition));
+		}
+	}
+
+	virtual void process_gsml_property(const gsml_property &property) override
+	{
+		this->add_condition(condition<scope_type>::from_gsml_property(property));
+	}
+
+	virtual void process_gsml_scope(const gsml_data &scope) override
+	{
+		this->add_condition(condition<scope_type>::from_gsml_scope(scope));
+	}
+
+	virtual void check_validity() const override
+	{
+		base_type::check_validity();
+
+		//the condition tree is complete once it is validated, so it can be compiled
+		this->compile();
+	}
+
+	void add_condition(std::unique_ptr<const condition_base_type> &&condition)
+	{
+		this->child_conditions.push_back(condition.get());
+		this->compiled_conditions.clear();
+		this->compiled = false;
+
+		base_type::add_condition(std::move(condition));
+	}
+
+	const std::vector<const condition_base_type *> &get_child_conditions() const
 	{
+		return this->child_conditions;
 	}
 
-	explicit and_condition(std::vector<std::unique_ptr<const condition_base<scope_type, read_only_context>>> &&conditions)
-		: and_condition_base<scope_type, read_only_context, condition<scope_type>>(std::move(conditions))
+	bool is_compiled() const
 	{
+		return this->compiled;
 	}
+
+	const std::vector<const condition_base_type *> &get_compiled_conditions() const
+	{
+		return this->compiled_conditions;
+	}
+
+	void compile() const;
+
+	virtual bool check_assignment(const scope_type *scope, const read_only_context &ctx) const override
+	{
+		if (this->compiled && !condition_tree_check_scope::is_active()) {
+			for (const condition_base_type *condition : this->compiled_conditions) {
+				if (!condition->check(scope, ctx)) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		return base_type::check_assignment(scope, ctx);
+	}
+
+	//checks the conditions by walking the whole condition tree, regardless of whether it or any of the conditions nested in it have been compiled
+	bool check_tree(const scope_type *scope, const read_only_context &ctx) const
+	{
+		const condition_tree_check_scope tree_check_scope;
+		return base_type::check_assignment(scope, ctx);
+	}
+
+private:
+	void add_compiled_condition(const condition_base_type *condition) const;
+
+	std::vector<const condition_base_type *> child_conditions;
+
+	//the conditions of the tree flattened into a single sequence, with nested "and" conditions and scripted conditions inlined, checked in order with the first false one ending the check
+	mutable std::vector<const condition_base_type *> compiled_conditions;
+	mutable bool compiled = false;
 };
 
 extern template class and_condition<character>;
@@ -38,6 +38,11 @@ public:
 		return class_identifier;
 	}
 
+	const scripted_condition_base<scope_type, read_only_context, condition<scope_type>> *get_scripted_condition() const
+	{
+		return this->scripted_condition;
+	}
+
 	virtual bool check_assignment(const scope_type *scope, const read_only_context &ctx) const override
 	{
 		return this->scripted_condition->get_conditions()->check(scope, ctx);
@@ -18,6 +18,65 @@ class population_unit;
 class province;
 class site;
 
+//a flat map of saved values for script contexts; it doesn't allocate until something is saved, since a context is created for nearly every condition check, but most of them never save anything
+template <typename value_type>
+class context_value_map final
+{
+public:
+	using entry_type = std::pair<std::string, value_type>;
+
+	bool empty() const
+	{
+		return this->entries.empty();
+	}
+
+	typename std::vector<entry_type>::const_iterator begin() const
+	{
+		return this->entries.begin();
+	}
+
+	typename std::vector<entry_type>::const_iterator end() const
+	{
+		return this->entries.end();
+	}
+
+	const value_type *find(const std::string &name) const
+	{
+		for (const entry_type &entry : this->entries) {
+			if (entry.first == name) {
+				return &entry.second;
+			}
+		}
+
+		return nullptr;
+	}
+
+	value_type &operator [](const std::string &name)
+	{
+		for (entry_type &entry : this->entries) {
+			if (entry.first == name) {
+				return entry.second;
+			}
+		}
+
+		return this->entries.emplace_back(name, value_type()).second;
+	}
+
+	template <typename other_value_type>
+	void assign(const context_value_map<other_value_type> &other)
+	{
+		this->entries.clear();
+		this->entries.reserve(static_cast<size_t>(std::distance(other.begin(), other.end())));
+
+		for (const auto &[name, value] : other) {
+			this->entries.emplace_back(name, value);
+		}
+	}
+
+private:
+	std::vector<entry_type> entries;
+};
+
 //script context for e.g. events
 template <bool read_only>
 struct context_base
@@ -43,7 +102,7 @@ struct context_base
 	gsml_data to_gsml_data(const std::string &tag) const;
 
 	template <typename scope_type>
-	std::map<std::string, scope_type *> &get_saved_scopes()
+	context_value_map<scope_type *> &get_saved_scopes()
 	{
 		if constexpr (std::is_same_v<scope_type, const character>) {
 			return this->saved_character_scopes;
@@ -61,7 +120,7 @@ struct context_base
 	}
 
 	template <typename scope_type>
-	const std::map<std::string, scope_type *> &get_saved_scopes() const
+	const context_value_map<scope_type *> &get_saved_scopes() const
 	{
 		if constexpr (std::is_same_v<scope_type, const character>) {
 			return this->saved_character_scopes;
@@ -81,12 +140,10 @@ struct context_base
 	template <typename scope_type>
 	scope_type *get_saved_scope(const std::string &scope_name) const
 	{
-		const std::map<std::string, scope_type *> &saved_scopes = this->get_saved_scopes<scope_type>();
-
-		const auto find_iterator = saved_scopes.find(scope_name);
+		scope_type *const *saved_scope = this->get_saved_scopes<scope_type>().find(scope_name);
 
-		if (find_iterator != saved_scopes.end()) {
-			return find_iterator->second;
+		if (saved_scope != nullptr) {
+			return *saved_scope;
 		}
 
 		return nullptr;
@@ -108,10 +165,10 @@ struct context_base
 
 	const std::string &get_saved_string(const std::string &name) const
 	{
-		const auto find_iterator = this->saved_strings.find(name);
+		const std::string *saved_string = this->saved_strings.find(name);
 
-		if (find_iterator != this->saved_strings.end()) {
-			return find_iterator->second;
+		if (saved_string != nullptr) {
+			return *saved_string;
 		}
 
 		static const std::string empty_str;
@@ -121,13 +178,13 @@ struct context_base
 	scope_variant_type root_scope = std::monostate();
 	scope_variant_type source_scope = std::monostate();
 	scope_variant_type previous_scope = std::monostate();
-	std::map<std::string, const character *> saved_character_scopes;
-	std::map<std::string, const domain *> saved_domain_scopes;
-	std::map<std::string, military_unit_ptr> saved_military_unit_scopes;
-	std::map<std::string, population_unit_ptr> saved_population_unit_scopes;
-	std::map<std::string, const province *> saved_province_scopes;
-	std::map<std::string, const site *> saved_site_scopes;
-	std::map<std::string, std::string> saved_strings;
+	context_value_map<const character *> saved_character_scopes;
+	context_value_map<const domain *> saved_domain_scopes;
+	context_value_map<military_unit_ptr> saved_military_unit_scopes;
+	context_value_map<population_unit_ptr> saved_population_unit_scopes;
+	context_value_map<const province *> saved_province_scopes;
+	context_value_map<const site *> saved_site_scopes;
+	context_value_map<std::string> saved_strings;
 	army_ptr attacking_army = nullptr;
 	army_ptr defending_army = nullptr;
 	party_ptr party;
@@ -189,6 +246,9 @@ public:
 		this->saved_site_scopes = ctx.saved_site_scopes;
 		this->saved_strings = ctx.saved_strings;
 
+		this->saved_military_unit_scopes.assign(ctx.saved_military_unit_scopes);
+		this->saved_population_unit_scopes.assign(ctx.saved_population_unit_scopes);
+
 		this->attacking_army = ctx.attacking_army;
 		this->defending_army = ctx.defending_army;
 
@@ -196,13 +256,6 @@ public:
 		this->dungeon_site = ctx.dungeon_site;
 		this->dungeon_area = ctx.dungeon_area;
 		this->in_combat = ctx.in_combat;
-
-		for (const auto &[str, military_unit] : ctx.saved_military_unit_scopes) {
-			this->saved_military_unit_scopes[str] = military_unit;
-		}
-		for (const auto &[str, population_unit] : ctx.saved_population_unit_scopes) {
-			this->saved_population_unit_scopes[str] = population_unit;
-		}
 	}
 
 	template <typename scope_type>
@@ -11,6 +11,49 @@
 
 namespace metternich {
 
+namespace {
+
+thread_local int factor_memo_depth = 0;
+thread_local std::map<std::pair<const void *, const void *>, std::vector<bool>> factor_memo;
+
+}
+
+bool factor_memo_scope::is_active()
+{
+	return factor_memo_depth > 0;
+}
+
+const std::vector<bool> *factor_memo_scope::find_modifier_conditions(const void *factor, const void *scope)
+{
+	const auto find_iterator = factor_memo.find(std::make_pair(factor, scope));
+	if (find_iterator != factor_memo.end()) {
+		++factor_memo_scope::hit_count;
+		return &find_iterator->second;
+	}
+
+	++factor_memo_scope::miss_count;
+	return nullptr;
+}
+
+const std::vector<bool> &factor_memo_scope::add_modifier_conditions(const void *factor, const void *scope, std::vector<bool> &&modifier_conditions)
+{
+	return factor_memo[std::make_pair(factor, scope)] = std::move(modifier_conditions);
+}
+
+factor_memo_scope::factor_memo_scope()
+{
+	++factor_memo_depth;
+}
+
+factor_memo_scope::~factor_memo_scope()
+{
+	--factor_memo_depth;
+
+	if (factor_memo_depth == 0) {
+		factor_memo.clear();
+	}
+}
+
 template <typename scope_type>
 factor<scope_type>::factor()
 {
@@ -77,9 +120,21 @@ decimillesimal_int factor<scope_type>::calculate(const scope_type *scope, const
 {
 	decimillesimal_int value = base_value;
 
-	if (scope != nullptr) {
-		for (const std::unique_ptr<factor_modifier<scope_type>> &modifier : this->modifiers) {
-			if (modifier->check_conditions(scope)) {
+	if (scope != nullptr && !this->modifiers.empty()) {
+		const std::vector<bool> *modifier_conditions = nullptr;
+		if (factor_memo_scope::is_active()) {
+			modifier_conditions = factor_memo_scope::find_modifier_conditions(this, scope);
+
+			if (modifier_conditions == nullptr) {
+				modifier_conditions = &factor_memo_scope::add_modifier_conditions(this, scope, this->check_modifier_conditions(scope));
+			}
+		}
+
+		for (size_t i = 0; i < this->modifiers.size(); ++i) {
+			const std::unique_ptr<factor_modifier<scope_type>> &modifier = this->modifiers[i];
+
+			const bool conditions_fulfilled = modifier_conditions != nullptr ? modifier_conditions->at(i) : modifier->check_conditions(scope);
+			if (conditions_fulfilled) {
 				decimillesimal_int modifier_factor = modifier->get_factor();
 
 				if constexpr (std::is_same_v<scope_type, province>) {
@@ -106,6 +161,19 @@ decimillesimal_int factor<scope_type>::calculate(const scope_type *scope) const
 	return this->calculate(scope, this->base_value);
 }
 
+template <typename scope_type>
+std::vector<bool> factor<scope_type>::check_modifier_conditions(const scope_type *scope) const
+{
+	std::vector<bool> modifier_conditions;
+	modifier_conditions.reserve(this->modifiers.size());
+
+	for (const std::unique_ptr<factor_modifier<scope_type>> &modifier : this->modifiers) {
+		modifier_conditions.push_back(modifier->check_conditions(scope));
+	}
+
+	return modifier_conditions;
+}
+
 template class factor<character>;
 template class factor<domain>;
 template class factor<military_unit>;
@@ -41,11 +41,44 @@ public:
 	decimillesimal_int calculate(const scope_type *scope, const decimillesimal_int &base_value) const;
 	decimillesimal_int calculate(const scope_type *scope) const;
 
+private:
+	std::vector<bool> check_modifier_conditions(const scope_type *scope) const;
+
 private:
 	decimillesimal_int base_value; //the base value for the factor
 	std::vector<std::unique_ptr<factor_modifier<scope_type>>> modifiers; //modifiers for the factor
 };
 
+//while an instance of this is alive, which modifiers of a factor apply to a given scope is memoized on the current thread, so that calculating the same factors for the same scopes again (e.g. with a different base value) doesn't check the modifier conditions again
+//it must only be used around code which doesn't change the game state, since memoized results are kept until the outermost memo scope ends
+class factor_memo_scope final
+{
+public:
+	static bool is_active();
+	static const std::vector<bool> *find_modifier_conditions(const void *factor, const void *scope);
+	static const std::vector<bool> &add_modifier_conditions(const void *factor, const void *scope, std::vector<bool> &&modifier_conditions);
+
+	static int64_t get_hit_count()
+	{
+		return factor_memo_scope::hit_count;
+	}
+
+	static int64_t get_miss_count()
+	{
+		return factor_memo_scope::miss_count;
+	}
+
+	factor_memo_scope();
+	~factor_memo_scope();
+
+	factor_memo_scope(const factor_memo_scope &other) = delete;
+	factor_memo_scope &operator =(const factor_memo_scope &other) = delete;
+
+private:
+	static inline std::atomic<int64_t> hit_count = 0;
+	static inline std::atomic<int64_t> miss_count = 0;
+};
+
 extern template class factor<character>;
 extern template class factor<domain>;
 extern template class factor<military_unit>;
@@ -40,6 +40,7 @@
 #include "technology/technological_period.h"
 #include "technology/technology_category.h"
 #include "technology/technology_subcategory.h"
+#include "ui/text_cache.h"
 #include "unit/civilian_unit_type.h"
 #include "unit/military_unit_domain.h"
 #include "unit/military_unit_type.h"
@@ -76,6 +77,42 @@ void technology::initialize_all()
 	technology::sort_instances(sort_function);
 	std::sort(technology::top_level_technologies.begin(), technology::top_level_technologies.end(), sort_function);
 
+	int index = 0;
+	for (technology *technology : technology::get_all()) {
+		technology->index = index;
+		++index;
+	}
+
+	//build the transitive closure of prerequisites, processing technologies in order of prerequisite depth, so that the closures of their prerequisites are already complete
+	std::vector<technology *> technologies_by_depth = technology::get_all();
+	std::stable_sort(technologies_by_depth.begin(), technologies_by_depth.end(), [](const technology *lhs, const technology *rhs) {
+		return lhs->get_total_prerequisite_depth() < rhs->get_total_prerequisite_depth();
+	});
+
+	for (technology *technology : technologies_by_depth) {
+		technology->prerequisite_closure.assign(technology::get_all().size(), false);
+
+		for (const metternich::technology *prerequisite : technology->get_prerequisites()) {
+			technology->prerequisite_closure[prerequisite->index] = true;
+
+			for (size_t i = 0; i < prerequisite->prerequisite_closure.size(); ++i) {
+				if (prerequisite->prerequisite_closure[i]) {
+					technology->prerequisite_closure[i] = true;
+				}
+			}
+		}
+	}
+
+	for (technology *technology : technologies_by_depth) {
+		technology->all_prerequisites.clear();
+
+		for (const metternich::technology *other_technology : technologies_by_depth) {
+			if (technology->prerequisite_closure[other_technology->index]) {
+				technology->all_prerequisites.push_back(other_technology);
+			}
+		}
+	}
+
 	for (technology *technology : technology::get_all()) {
 		if (!technology->child_technologies.empty()) {
 			std::sort(technology->child_technologies.begin(), technology->child_technologies.end(), sort_function);
@@ -432,13 +469,7 @@ bool technology::requires_technology(const technology *technology) const
 {
 	assert_throw(this != technology);
 
-	for (const metternich::technology *prerequisite : this->get_prerequisites()) {
-		if (prerequisite == technology || prerequisite->requires_technology(technology)) {
-			return true;
-		}
-	}
-
-	return false;
+	return this->prerequisite_closure.at(technology->index);
 }
 
 void technology::calculate_total_prerequisite_depth()
@@ -463,6 +494,9 @@ commodity_map<int64_t> technology::get_commodity_costs_for_domain(const domain *
 
 	commodity_map<int64_t> costs;
 
+	//the cost factor is calculated for each commodity, but with the same scope
+	const factor_memo_scope memo_scope;
+
 	for (const auto &[commodity, base_cost] : this->get_commodity_costs()) {
 		if (!commodity->is_enabled()) {
 			continue;
@@ -992,7 +1026,22 @@ std::string technology::get_effects_string(const domain *domain) const
 
 QString technology::get_effects_qstring(const domain *domain) const
 {
-	return QString::fromStdString(this->get_effects_string(domain));
+	return text_cache::get()->get(this, domain, 0, [this, domain]() {
+		return QString::fromStdString(this->get_effects_string(domain));
+	});
+}
+
+void technology::precompute_effects_strings(const domain *domain)
+{
+	for (const technology *technology : technology::get_all()) {
+		if (!technology->is_available_for_domain(domain)) {
+			continue;
+		}
+
+		text_cache::get()->queue_precomputation([technology, domain]() {
+			technology->get_effects_qstring(domain);
+		});
+	}
 }
 
 bool technology::is_hidden_in_tree() const
@@ -184,13 +184,18 @@ public:
 		return this->free_technologies;
 	}
 
-	const std::vector<technology *> get_prerequisites() const
+	const std::vector<technology *> &get_prerequisites() const
 	{
 		return this->prerequisites;
 	}
 
 	QVariantList get_prerequisites_qvariant_list() const;
 
+	const std::vector<const technology *> &get_all_prerequisites() const
+	{
+		return this->all_prerequisites;
+	}
+
 	bool requires_technology(const technology *technology) const;
 
 	int get_total_prerequisite_depth() const
@@ -467,6 +472,7 @@ public:
 	std::string get_modifier_string(const province *province) const;
 	std::string get_effects_string(const domain *domain) const;
 	Q_INVOKABLE QString get_effects_qstring(const metternich::domain *domain) const;
+	static void precompute_effects_strings(const domain *domain);
 
 	virtual named_data_entry *get_tree_parent() const override
 	{
@@ -531,6 +537,9 @@ private:
 	int free_technologies = 0; //grants free technologies for the first country to research
 	std::vector<technology *> prerequisites;
 	int total_prerequisite_depth = 0;
+	int index = -1; //dense index, used for prerequisite bitsets
+	std::vector<bool> prerequisite_closure; //dense bitset over technology indices, marking all direct and indirect prerequisites
+	std::vector<const technology *> all_prerequisites; //all direct and indirect prerequisites, ordered by total prerequisite depth, so that each technology comes after its own prerequisites
 	std::vector<const technology *> leads_to;
 	const technology *parent_technology = nullptr;
 	std::vector<const technology *> child_technologies;
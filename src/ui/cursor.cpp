@@ -4,12 +4,12 @@
 
 #include "database/database.h"
 #include "database/preferences.h"
+#include "ui/image_scaling.h"
+#include "ui/scaled_image_cache.h"
 #include "util/assert_util.h"
 #include "util/image_util.h"
 #include "util/path_util.h"
 
-#include "xbrz.h"
-
 #pragma warning(push, 0)
 #include <QPixmap>
 #pragma warning(pop)
@@ -103,16 +103,27 @@ QCoro::Task<void> cursor::load_image()
 		}
 	}
 
-	QImage cursor_image = QImage(path::to_qstring(filepath));
-	assert_throw(!cursor_image.isNull());
+	const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
+	std::string cache_key;
+	QImage cursor_image;
+
+	if (image_scale_factor != scale_factor && scaling_algorithm_enabled) {
+		cache_key = scaled_image_cache::get()->build_key(filepath, scale_factor, std::string());
+		cursor_image = scaled_image_cache::get()->load_image(cache_key);
+	}
+
+	const bool is_cached = !cursor_image.isNull();
+
+	if (!is_cached) {
+		cursor_image = QImage(path::to_qstring(filepath));
+		assert_throw(!cursor_image.isNull());
+	}
 
-	if (image_scale_factor != scale_factor) {
-		const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
-		co_await QtConcurrent::run([this, &cursor_image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled]() {
+	if (image_scale_factor != scale_factor && !is_cached) {
+		co_await QtConcurrent::run([this, &cursor_image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled, &cache_key]() {
 			if (scaling_algorithm_enabled) {
-				cursor_image = image::scale<QImage::Format_ARGB32>(cursor_image, scale_factor / image_scale_factor, cursor_image.size(), [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-					xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-				});
+				cursor_image = image_scaling::scale(cursor_image, scale_factor / image_scale_factor, cursor_image.size());
+				scaled_image_cache::get()->save_image(cache_key, cursor_image);
 			} else {
 				cursor_image = cursor_image.scaled(cursor_image.size() * scale_factor);
 			}
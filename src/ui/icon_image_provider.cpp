@@ -5,13 +5,13 @@
 #include "database/defines.h"
 #include "database/preferences.h"
 #include "ui/icon.h"
+#include "ui/image_scaling.h"
+#include "ui/scaled_image_cache.h"
 #include "util/assert_util.h"
 #include "util/image_util.h"
 #include "util/path_util.h"
 #include "util/string_util.h"
 
-#include "xbrz.h"
-
 namespace metternich {
 
 icon_image_provider::icon_image_provider()
@@ -57,6 +57,19 @@ QCoro::Task<void> icon_image_provider::load_image(const std::string id)
 		}
 	}
 
+	const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
+	std::string cache_key;
+
+	if (image_scale_factor != scale_factor && scaling_algorithm_enabled) {
+		cache_key = scaled_image_cache::get()->build_key(filepath, scale_factor, icon->get_hue_rotation(), icon->get_hue_ignored_colors(), id.substr(identifier.size()));
+
+		QImage cached_image = scaled_image_cache::get()->load_image(cache_key);
+		if (!cached_image.isNull()) {
+			this->set_image(id, std::move(cached_image));
+			co_return;
+		}
+	}
+
 	QImage image(path::to_qstring(filepath));
 	assert_throw(!image.isNull());
 
@@ -91,12 +104,10 @@ QCoro::Task<void> icon_image_provider::load_image(const std::string id)
 	}
 
 	if (image_scale_factor != scale_factor) {
-		const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
-		co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled]() {
+		co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled, &cache_key]() {
 			if (scaling_algorithm_enabled) {
-				image = image::scale<QImage::Format_ARGB32>(image, scale_factor / image_scale_factor, [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-					xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-				});
+				image = image_scaling::scale(image, scale_factor / image_scale_factor);
+				scaled_image_cache::get()->save_image(cache_key, image);
 			} else {
 				image = image.scaled(image.size() * scale_factor);
 			}
@@ -0,0 +1,50 @@
+#include "metternich.h"
+
+#include "ui/image_scaling.h"
+
+#include "util/centesimal_int.h"
+#include "util/image_util.h"
+
+#include "xbrz.h"
+
+namespace metternich::image_scaling {
+
+void xbrz_scale(const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height)
+{
+	//xBRZ has a minor overhead for the first row of each slice, so slices should not be too small
+	static constexpr int min_rows_per_slice = 16;
+
+	const int thread_count = std::max(1, QThread::idealThreadCount());
+	const int rows_per_slice = std::max(min_rows_per_slice, (src_height + thread_count - 1) / thread_count);
+
+	if (rows_per_slice >= src_height) {
+		xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
+		return;
+	}
+
+	std::vector<std::pair<int, int>> slices;
+	for (int y_first = 0; y_first < src_height; y_first += rows_per_slice) {
+		slices.emplace_back(y_first, std::min(y_first + rows_per_slice, src_height));
+	}
+
+	//the slices do not overlap, so they can be scaled concurrently on the same target image
+	QtConcurrent::blockingMap(slices, [factor, src, tgt, src_width, src_height](const std::pair<int, int> &slice) {
+		xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB, xbrz::ScalerCfg(), slice.first, slice.second);
+	});
+}
+
+QImage scale(const QImage &image, const centesimal_int &scale_factor)
+{
+	return image::scale<QImage::Format_ARGB32>(image, scale_factor, [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
+		image_scaling::xbrz_scale(factor, src, tgt, src_width, src_height);
+	});
+}
+
+QImage scale(const QImage &image, const centesimal_int &scale_factor, const QSize &frame_size)
+{
+	return image::scale<QImage::Format_ARGB32>(image, scale_factor, frame_size, [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
+		image_scaling::xbrz_scale(factor, src, tgt, src_width, src_height);
+	});
+}
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+namespace archimedes {
+	template <int N>
+	class fractional_int;
+
+	using centesimal_int = fractional_int<2>;
+}
+
+namespace metternich::image_scaling {
+
+//scales the image with xBRZ, processing bands of rows in parallel
+extern void xbrz_scale(const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height);
+
+[[nodiscard]]
+extern QImage scale(const QImage &image, const centesimal_int &scale_factor);
+
+[[nodiscard]]
+extern QImage scale(const QImage &image, const centesimal_int &scale_factor, const QSize &frame_size);
+
+}
@@ -4,13 +4,13 @@
 
 #include "database/database.h"
 #include "database/preferences.h"
+#include "ui/image_scaling.h"
+#include "ui/scaled_image_cache.h"
 #include "util/assert_util.h"
 #include "util/image_util.h"
 #include "util/path_util.h"
 #include "util/string_util.h"
 
-#include "xbrz.h"
-
 namespace metternich {
 
 interface_image_provider::interface_image_provider()
@@ -54,23 +54,36 @@ QCoro::Task<void> interface_image_provider::load_image(const std::string id)
 		}
 	}
 
-	QImage image(path::to_qstring(filepath));
-	assert_throw(!image.isNull());
+	const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
+	std::string cache_key;
+	QImage image;
+
+	if (image_scale_factor != scale_factor && scaling_algorithm_enabled) {
+		cache_key = scaled_image_cache::get()->build_key(filepath, scale_factor, std::string());
+		image = scaled_image_cache::get()->load_image(cache_key);
+	}
+
+	const bool is_cached = !image.isNull();
+
+	if (!is_cached) {
+		image = QImage(path::to_qstring(filepath));
+		assert_throw(!image.isNull());
+	}
 
 	if (is_frame_image) {
 		static constexpr QSize frame_size(32, 32);
 
 		if (image_scale_factor != scale_factor) {
-			const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
-			co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled]() {
-				if (scaling_algorithm_enabled) {
-					image = image::scale<QImage::Format_ARGB32>(image, scale_factor / image_scale_factor, frame_size * image_scale_factor, [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-						xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-					});
-				} else {
-					image = image.scaled(image.size() * scale_factor);
-				}
-			});
+			if (!is_cached) {
+				co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled, &cache_key]() {
+					if (scaling_algorithm_enabled) {
+						image = image_scaling::scale(image, scale_factor / image_scale_factor, frame_size * image_scale_factor);
+						scaled_image_cache::get()->save_image(cache_key, image);
+					} else {
+						image = image.scaled(image.size() * scale_factor);
+					}
+				});
+			}
 
 			const QSize scaled_frame_size = frame_size * preferences::get()->get_scale_factor();
 
@@ -85,13 +98,11 @@ QCoro::Task<void> interface_image_provider::load_image(const std::string id)
 			}
 		}
 	} else {
-		if (image_scale_factor != scale_factor) {
-			const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
-			co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled]() {
+		if (image_scale_factor != scale_factor && !is_cached) {
+			co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled, &cache_key]() {
 				if (scaling_algorithm_enabled) {
-					image = image::scale<QImage::Format_ARGB32>(image, scale_factor / image_scale_factor, [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-						xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-					});
+					image = image_scaling::scale(image, scale_factor / image_scale_factor);
+					scaled_image_cache::get()->save_image(cache_key, image);
 				} else {
 					image = image.scaled(image.size() * scale_factor);
 				}
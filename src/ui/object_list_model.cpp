@@ -0,0 +1,66 @@
+#include "metternich.h"
+
+#include "ui/object_list_model.h"
+
+#include "util/assert_util.h"
+#include "util/exception_util.h"
+
+namespace metternich {
+
+int object_list_model::rowCount(const QModelIndex &parent) const
+{
+	if (parent.isValid()) {
+		return 0;
+	}
+
+	return this->get_count();
+}
+
+QVariant object_list_model::data(const QModelIndex &index, const int role) const
+{
+	if (!index.isValid()) {
+		return QVariant();
+	}
+
+	try {
+		switch (role) {
+			case role::object:
+				return QVariant::fromValue(this->objects.at(index.row()));
+			default:
+				throw std::runtime_error(std::format("Invalid object list model role: {}.", role));
+		}
+	} catch (...) {
+		exception::report(std::current_exception());
+	}
+
+	return QVariant();
+}
+
+void object_list_model::add_object(const QObject *object)
+{
+	assert_throw(object != nullptr);
+
+	const int row = this->get_count();
+
+	this->beginInsertRows(QModelIndex(), row, row);
+	this->objects.push_back(const_cast<QObject *>(object));
+	this->endInsertRows();
+
+	emit count_changed();
+}
+
+void object_list_model::remove_object(const QObject *object)
+{
+	const auto find_iterator = std::find(this->objects.begin(), this->objects.end(), object);
+	assert_throw(find_iterator != this->objects.end());
+
+	const int row = static_cast<int>(std::distance(this->objects.begin(), find_iterator));
+
+	this->beginRemoveRows(QModelIndex(), row, row);
+	this->objects.erase(find_iterator);
+	this->endRemoveRows();
+
+	emit count_changed();
+}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#pragma warning(push, 0)
+#include <QAbstractListModel>
+#pragma warning(pop)
+
+namespace metternich {
+
+//a list model of objects for views, which is updated incrementally as objects are added or removed, instead of the view having to recreate all of its delegates whenever the list changes
+class object_list_model final : public QAbstractListModel
+{
+	Q_OBJECT
+
+	Q_PROPERTY(int count READ get_count NOTIFY count_changed)
+
+public:
+	enum role {
+		object = Qt::UserRole
+	};
+
+	virtual int rowCount(const QModelIndex &parent = QModelIndex()) const override final;
+	virtual QVariant data(const QModelIndex &index, const int role) const override final;
+
+	virtual QHash<int, QByteArray> roleNames() const override final
+	{
+		QHash<int, QByteArray> role_names = QAbstractListModel::roleNames();
+
+		role_names.insert(static_cast<int>(role::object), "object");
+
+		return role_names;
+	}
+
+	int get_count() const
+	{
+		return static_cast<int>(this->objects.size());
+	}
+
+	template <typename container_type>
+	void reset(const container_type &container)
+	{
+		this->beginResetModel();
+
+		this->objects.clear();
+		for (const auto &element : container) {
+			this->objects.push_back(const_cast<QObject *>(static_cast<const QObject *>(std::to_address(element))));
+		}
+
+		this->endResetModel();
+
+		emit count_changed();
+	}
+
+	void clear()
+	{
+		this->reset(std::vector<QObject *>());
+	}
+
+	void add_object(const QObject *object);
+	void remove_object(const QObject *object);
+
+signals:
+	void count_changed();
+
+private:
+	std::vector<QObject *> objects;
+};
+
+}
@@ -3,15 +3,15 @@
 #include "ui/portrait_image_provider.h"
 
 #include "database/preferences.h"
+#include "ui/image_scaling.h"
 #include "ui/portrait.h"
+#include "ui/scaled_image_cache.h"
 #include "util/assert_util.h"
 #include "util/exception_util.h"
 #include "util/image_util.h"
 #include "util/path_util.h"
 #include "util/string_util.h"
 
-#include "xbrz.h"
-
 namespace metternich {
 
 portrait_image_provider::portrait_image_provider()
@@ -65,28 +65,37 @@ QCoro::Task<void> portrait_image_provider::load_image(const std::string id)
 			}
 		}
 
-		QImage image(path::to_qstring(filepath));
-		assert_throw(!image.isNull());
+		const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
+		std::string cache_key;
+		QImage image;
 
-		if (portrait->get_hue_rotation() != 0) {
-			image::rotate_hue(image, portrait->get_hue_rotation(), portrait->get_hue_ignored_colors());
+		if (image_scale_factor != scale_factor && scaling_algorithm_enabled) {
+			cache_key = scaled_image_cache::get()->build_key(filepath, scale_factor, portrait->get_hue_rotation(), portrait->get_hue_ignored_colors(), is_grayscale ? "grayscale" : "");
+			image = scaled_image_cache::get()->load_image(cache_key);
 		}
 
-		if (is_grayscale) {
-			image::apply_grayscale(image);
-		}
+		if (image.isNull()) {
+			image = QImage(path::to_qstring(filepath));
+			assert_throw(!image.isNull());
+
+			if (portrait->get_hue_rotation() != 0) {
+				image::rotate_hue(image, portrait->get_hue_rotation(), portrait->get_hue_ignored_colors());
+			}
 
-		if (image_scale_factor != scale_factor) {
-			const bool scaling_algorithm_enabled = preferences::get()->is_scaling_algorithm_enabled();
-			co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled]() {
-				if (scaling_algorithm_enabled) {
-					image = image::scale<QImage::Format_ARGB32>(image, scale_factor / image_scale_factor, [](const size_t factor, const uint32_t *src, uint32_t *tgt, const int src_width, const int src_height) {
-						xbrz::scale(factor, src, tgt, src_width, src_height, xbrz::ColorFormat::ARGB);
-					});
-				} else {
-					image = image.scaled(image.size() * scale_factor);
-				}
-			});
+			if (is_grayscale) {
+				image::apply_grayscale(image);
+			}
+
+			if (image_scale_factor != scale_factor) {
+				co_await QtConcurrent::run([this, &image, &scale_factor, &image_scale_factor, scaling_algorithm_enabled, &cache_key]() {
+					if (scaling_algorithm_enabled) {
+						image = image_scaling::scale(image, scale_factor / image_scale_factor);
+						scaled_image_cache::get()->save_image(cache_key, image);
+					} else {
+						image = image.scaled(image.size() * scale_factor);
+					}
+				});
+			}
 		}
 
 		const QSize expected_size((64 * scale_factor).to_int(), (64 * scale_factor).to_int());
@@ -0,0 +1,188 @@
+#include "metternich.h"
+
+#include "ui/scaled_image_cache.h"
+
+#include "database/database.h"
+#include "util/centesimal_int.h"
+#include "util/exception_util.h"
+#include "util/log_util.h"
+#include "util/path_util.h"
+
+#pragma warning(push, 0)
+#include <QCryptographicHash>
+#include <QSaveFile>
+#pragma warning(pop)
+
+namespace metternich {
+
+std::filesystem::path scaled_image_cache::get_path()
+{
+	//each version has its own directory, so that images cached by other versions can be removed as a whole
+	return database::get_user_data_path() / "cache" / "scaled_images" / std::to_string(scaled_image_cache::version);
+}
+
+std::string scaled_image_cache::build_key(const std::filesystem::path &source_filepath, const centesimal_int &scale_factor, const int hue_rotation, const color_set &hue_ignored_colors, const std::string &state)
+{
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+
+	hash.addData(QByteArray::number(scaled_image_cache::version));
+	hash.addData(this->get_file_hash(source_filepath));
+	hash.addData(QByteArray::fromStdString(scale_factor.to_string()));
+	hash.addData(QByteArray::number(hue_rotation));
+
+	for (const QColor &color : hue_ignored_colors) {
+		hash.addData(QByteArray::number(color.rgba()));
+	}
+
+	hash.addData(QByteArray::fromStdString(state));
+
+	return hash.result().toHex().toStdString();
+}
+
+QImage scaled_image_cache::load_image(const std::string &key) const
+{
+	const std::filesystem::path filepath = scaled_image_cache::get_path() / (key + ".png");
+
+	if (!std::filesystem::exists(filepath)) {
+		return QImage();
+	}
+
+	QImage image(path::to_qstring(filepath));
+
+	if (image.isNull()) {
+		log::log_error(std::format("Failed to load cached scaled image \"{}\".", path::to_string(filepath)));
+		return QImage();
+	}
+
+	if (image.format() != QImage::Format_ARGB32) {
+		image = image.convertToFormat(QImage::Format_ARGB32);
+	}
+
+	//mark the image as used, so that eviction removes the least recently used images first; the cached images are never modified after being written, so the write time can be used for this
+	std::error_code error_code;
+	std::filesystem::last_write_time(filepath, std::filesystem::file_time_type::clock::now(), error_code);
+
+	return image;
+}
+
+void scaled_image_cache::save_image(const std::string &key, const QImage &image) const
+{
+	//the cache only grows when images are saved, so it is checked for eviction once per session, before the first one
+	std::call_once(this->eviction_flag, [this]() {
+		this->evict();
+	});
+
+	const std::filesystem::path cache_path = scaled_image_cache::get_path();
+
+	std::error_code error_code;
+	std::filesystem::create_directories(cache_path, error_code);
+	if (error_code) {
+		log::log_error(std::format("Failed to create the scaled image cache directory \"{}\": {}", path::to_string(cache_path), error_code.message()));
+		return;
+	}
+
+	const std::filesystem::path filepath = cache_path / (key + ".png");
+
+	//write to a temporary file first, so that an interrupted write never leaves a truncated image in the cache
+	QSaveFile file(path::to_qstring(filepath));
+	if (!file.open(QIODevice::WriteOnly) || !image.save(&file, "PNG") || !file.commit()) {
+		log::log_error(std::format("Failed to save cached scaled image \"{}\".", path::to_string(filepath)));
+	}
+}
+
+QByteArray scaled_image_cache::get_file_hash(const std::filesystem::path &filepath)
+{
+	const std::filesystem::file_time_type last_write_time = std::filesystem::last_write_time(filepath);
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	const auto find_iterator = this->file_hashes.find(filepath);
+	if (find_iterator != this->file_hashes.end() && find_iterator->second.first == last_write_time) {
+		return find_iterator->second.second;
+	}
+
+	QByteArray file_hash;
+
+	QFile file(path::to_qstring(filepath));
+	if (file.open(QIODevice::ReadOnly)) {
+		QCryptographicHash hash(QCryptographicHash::Sha1);
+		hash.addData(&file);
+		file_hash = hash.result();
+	} else {
+		throw std::runtime_error(std::format("Failed to open file \"{}\" for hashing.", path::to_string(filepath)));
+	}
+
+	std::pair<std::filesystem::file_time_type, QByteArray> &file_hash_entry = this->file_hashes[filepath];
+	file_hash_entry = { last_write_time, std::move(file_hash) };
+	return file_hash_entry.second;
+}
+
+void scaled_image_cache::evict() const
+{
+	const std::filesystem::path cache_path = scaled_image_cache::get_path();
+	const std::filesystem::path root_path = cache_path.parent_path();
+
+	try {
+		if (!std::filesystem::exists(root_path)) {
+			return;
+		}
+
+		for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(root_path)) {
+			if (entry.path() != cache_path) {
+				std::filesystem::remove_all(entry.path());
+			}
+		}
+
+		if (!std::filesystem::exists(cache_path)) {
+			return;
+		}
+
+		struct cached_file final
+		{
+			std::filesystem::path path;
+			std::filesystem::file_time_type last_write_time;
+			uintmax_t size = 0;
+		};
+
+		std::vector<cached_file> cached_files;
+		uintmax_t total_size = 0;
+
+		const std::filesystem::file_time_type min_write_time = std::filesystem::file_time_type::clock::now() - scaled_image_cache::max_unused_age;
+
+		for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(cache_path)) {
+			if (!entry.is_regular_file()) {
+				continue;
+			}
+
+			if (entry.last_write_time() < min_write_time) {
+				std::filesystem::remove(entry.path());
+				continue;
+			}
+
+			cached_files.emplace_back(entry.path(), entry.last_write_time(), entry.file_size());
+			total_size += entry.file_size();
+		}
+
+		if (total_size <= scaled_image_cache::max_size) {
+			return;
+		}
+
+		std::sort(cached_files.begin(), cached_files.end(), [](const cached_file &lhs, const cached_file &rhs) {
+			return lhs.last_write_time < rhs.last_write_time;
+		});
+
+		for (const cached_file &cached_file : cached_files) {
+			if (total_size <= scaled_image_cache::max_size) {
+				break;
+			}
+
+			std::filesystem::remove(cached_file.path);
+			total_size -= cached_file.size;
+		}
+	} catch (...) {
+		exception::report(std::current_exception());
+		log::log_error(std::format("Failed to evict images from the scaled image cache \"{}\".", path::to_string(cache_path)));
+	}
+}
+
+}
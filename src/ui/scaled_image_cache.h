@@ -0,0 +1,50 @@
+#pragma once
+
+#include "util/color_container.h"
+#include "util/singleton.h"
+
+namespace archimedes {
+	template <int N>
+	class fractional_int;
+
+	using centesimal_int = fractional_int<2>;
+}
+
+namespace metternich {
+
+//persistent on-disk cache of upscaled images, so that restarting the game or changing the scale factor back and forth does not require rescaling them
+class scaled_image_cache final : public singleton<scaled_image_cache>
+{
+public:
+	//increment when the scaling pipeline changes in a way which would make previously cached images invalid
+	static constexpr int version = 1;
+
+	//cached images not used for longer than this are evicted, as are the least recently used ones when the cache grows beyond its maximum size
+	static constexpr std::chrono::days max_unused_age = std::chrono::days(30);
+	static constexpr uintmax_t max_size = 512 * 1024 * 1024;
+
+	static std::filesystem::path get_path();
+
+	std::string build_key(const std::filesystem::path &source_filepath, const centesimal_int &scale_factor, const int hue_rotation, const color_set &hue_ignored_colors, const std::string &state);
+
+	std::string build_key(const std::filesystem::path &source_filepath, const centesimal_int &scale_factor, const std::string &state)
+	{
+		return this->build_key(source_filepath, scale_factor, 0, color_set(), state);
+	}
+
+	QImage load_image(const std::string &key) const;
+	void save_image(const std::string &key, const QImage &image) const;
+
+private:
+	QByteArray get_file_hash(const std::filesystem::path &filepath);
+
+	//removes the images cached by other versions, the ones which have not been used for too long, and then the least recently used ones until the cache fits its maximum size
+	void evict() const;
+
+private:
+	std::map<std::filesystem::path, std::pair<std::filesystem::file_time_type, QByteArray>> file_hashes;
+	std::mutex mutex;
+	mutable std::once_flag eviction_flag;
+};
+
+}
@@ -0,0 +1,104 @@
+#include "metternich.h"
+
+#include "ui/text_cache.h"
+
+#include "game/change_notifier.h"
+#include "game/game.h"
+#include "util/exception_util.h"
+
+namespace metternich {
+
+namespace {
+
+//invalidates the text cache whenever the player presses a mouse button or a key, so that the texts are regenerated after any command the player may have given
+class text_cache_input_filter final : public QObject
+{
+public:
+	explicit text_cache_input_filter(QObject *parent) : QObject(parent)
+	{
+	}
+
+	virtual bool eventFilter(QObject *watched, QEvent *event) override
+	{
+		switch (event->type()) {
+			case QEvent::MouseButtonPress:
+			case QEvent::MouseButtonRelease:
+			case QEvent::MouseButtonDblClick:
+			case QEvent::KeyPress:
+			case QEvent::KeyRelease:
+			case QEvent::TouchEnd:
+				text_cache::get()->invalidate();
+				break;
+			default:
+				break;
+		}
+
+		return QObject::eventFilter(watched, event);
+	}
+};
+
+}
+
+text_cache::text_cache()
+{
+	if (QCoreApplication::instance() == nullptr) {
+		return;
+	}
+
+	//the filter is owned by the application, so that it doesn't outlive it
+	QCoreApplication::instance()->installEventFilter(new text_cache_input_filter(QCoreApplication::instance()));
+}
+
+void text_cache::queue_precomputation(std::function<void()> &&function)
+{
+	this->precomputation_queue.push_back(std::move(function));
+
+	if (this->precomputation_scheduled) {
+		return;
+	}
+
+	this->precomputation_scheduled = true;
+	QTimer::singleShot(0, [this]() {
+		this->process_precomputation();
+	});
+}
+
+void text_cache::process_precomputation()
+{
+	if (!game::get()->is_running()) {
+		this->precomputation_queue.clear();
+		this->precomputation_scheduled = false;
+		return;
+	}
+
+	//don't generate texts from a half-processed turn, since they would be stale by the time the turn finishes anyway
+	if (change_notifier::get()->is_in_phase()) {
+		QTimer::singleShot(100, [this]() {
+			this->process_precomputation();
+		});
+		return;
+	}
+
+	if (!this->precomputation_queue.empty()) {
+		const std::function<void()> function = std::move(this->precomputation_queue.front());
+		this->precomputation_queue.pop_front();
+
+		try {
+			function();
+		} catch (...) {
+			exception::report(std::current_exception());
+		}
+	}
+
+	if (this->precomputation_queue.empty()) {
+		this->precomputation_scheduled = false;
+		return;
+	}
+
+	//generate one text per event loop iteration, so that input and rendering are not held up
+	QTimer::singleShot(0, [this]() {
+		this->process_precomputation();
+	});
+}
+
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "util/singleton.h"
+
+namespace metternich {
+
+//cache of generated interface texts, such as effects strings, keyed by the described object, the scope for which it is described, and a variant (e.g. single-line or not)
+//the whole cache is stale whenever the game state version changes; rather than each setter having to remember to invalidate it, that happens at central points: whenever a game data change is notified, when the game starts or stops, when the turn changes, when the turn pauses for a player choice, when an event option or decision has been processed, and whenever the player gives input, since any player command is the result of input
+class text_cache final : public singleton<text_cache>
+{
+public:
+	static int64_t get_hit_count()
+	{
+		return text_cache::hit_count;
+	}
+
+	static int64_t get_miss_count()
+	{
+		return text_cache::miss_count;
+	}
+
+	text_cache();
+
+	template <typename function_type>
+	const QString &get(const void *object, const void *scope, const int variant, const function_type &generate)
+	{
+		this->clear_if_stale();
+
+		const key key(object, scope, variant);
+
+		const auto find_iterator = this->texts.find(key);
+		if (find_iterator != this->texts.end()) {
+			++text_cache::hit_count;
+			return find_iterator->second;
+		}
+
+		++text_cache::miss_count;
+
+		QString text = generate();
+		return this->texts.insert_or_assign(key, std::move(text)).first->second;
+	}
+
+	uint64_t get_state_version() const
+	{
+		return this->state_version;
+	}
+
+	void invalidate()
+	{
+		++this->state_version;
+	}
+
+	//queue texts to be generated while the application is idle, so that e.g. opening a view with many described objects does not have to generate all of them at once
+	void queue_precomputation(std::function<void()> &&function);
+
+private:
+	void clear_if_stale()
+	{
+		if (this->texts_state_version == this->state_version) {
+			return;
+		}
+
+		this->texts.clear();
+		this->texts_state_version = this->state_version;
+	}
+
+	void process_precomputation();
+
+private:
+	using key = std::tuple<const void *, const void *, int>;
+
+	struct key_hash final
+	{
+		size_t operator()(const key &key) const
+		{
+			size_t seed = std::hash<const void *>()(std::get<0>(key));
+			seed ^= std::hash<const void *>()(std::get<1>(key)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+			seed ^= std::hash<int>()(std::get<2>(key)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+			return seed;
+		}
+	};
+
+	static inline std::atomic<int64_t> hit_count = 0;
+	static inline std::atomic<int64_t> miss_count = 0;
+
+	uint64_t state_version = 0;
+	uint64_t texts_state_version = 0;
+	std::unordered_map<key, QString, key_hash> texts;
+	std::deque<std::function<void()>> precomputation_queue;
+	bool precomputation_scheduled = false;
+};
+
+}
@@ -8,6 +8,7 @@
 #include "domain/domain_government.h"
 #include "engine_interface.h"
 #include "game/battle.h"
+#include "game/change_notifier.h"
 #include "game/game.h"
 #include "map/province.h"
 #include "map/province_game_data.h"
@@ -130,7 +131,12 @@ QCoro::Task<void> army::do_turn()
 
 				QFuture<bool> success_future = battle->get_future();
 
-				if (this->get_domain() == game::get()->get_player_domain() || defending_army->get_domain() == game::get()->get_player_domain()) {
+				std::optional<change_notification_pause> notification_pause;
+
+				if (!game::get()->is_player_ai_controlled() && (this->get_domain() == game::get()->get_player_domain() || defending_army->get_domain() == game::get()->get_player_domain())) {
+					//show the changes made so far while the player is fighting the battle
+					notification_pause.emplace();
+
 					game::get()->set_current_combat(std::move(battle));
 				} else {
 					QTimer::singleShot(0, [battle = std::move(battle)]() -> QCoro::Task<void> {
@@ -139,6 +145,7 @@ QCoro::Task<void> army::do_turn()
 				}
 
 				success = co_await success_future;
+				notification_pause.reset();
 
 				defending_army->clear();
 			} else {
@@ -20,6 +20,7 @@
 #include "game/game.h"
 #include "map/province.h"
 #include "map/province_game_data.h"
+#include "map/province_pathfinder.h"
 #include "script/condition/and_condition.h"
 #include "script/modifier.h"
 #include "species/phenotype.h"
@@ -345,6 +346,11 @@ const metternich::character *military_unit::get_commander() const
 }
 
 bool military_unit::can_move_to(const metternich::province *province) const
+{
+	return this->can_move_to(province, this->get_province());
+}
+
+bool military_unit::can_move_to(const metternich::province *province, const metternich::province *current_province) const
 {
 	switch (this->get_domain()) {
 		case military_unit_domain::land:
@@ -355,7 +361,7 @@ bool military_unit::can_move_to(const metternich::province *province) const
 		case military_unit_domain::water:
 			if (!province->is_water_zone()) {
 				//ships can only move from water to land provinces, but not between land provinces
-				if (this->get_province() != nullptr && !this->get_province()->is_water_zone()) {
+				if (current_province != nullptr && !current_province->is_water_zone()) {
 					return false;
 				}
 			}
@@ -390,6 +396,23 @@ bool military_unit::can_move_to(const metternich::province *province) const
 	return false;
 }
 
+province_path_mode military_unit::get_path_mode() const
+{
+	switch (this->get_domain()) {
+		case military_unit_domain::land:
+			return province_path_mode::military_land;
+		case military_unit_domain::water:
+			return province_path_mode::military_water;
+		case military_unit_domain::air:
+		case military_unit_domain::space:
+			return province_path_mode::military_air;
+		default:
+			break;
+	}
+
+	throw std::runtime_error(std::format("Military unit domain \"{}\" has no path mode.", std::to_string(static_cast<int>(this->get_domain()))));
+}
+
 bool military_unit::is_hostile_to(const metternich::domain *domain) const
 {
 	return this->get_country()->get_diplomacy()->can_attack(domain);
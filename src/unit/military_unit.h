@@ -26,6 +26,7 @@ enum class battle_resolution_type;
 enum class military_unit_category;
 enum class military_unit_domain;
 enum class military_unit_stat;
+enum class province_path_mode;
 
 class military_unit final : public QObject
 {
@@ -128,6 +129,10 @@ public:
 
 	bool can_move_to(const metternich::province *province) const;
 
+	//whether the unit could move to the province if it were in the current province
+	bool can_move_to(const metternich::province *province, const metternich::province *current_province) const;
+	province_path_mode get_path_mode() const;
+
 	bool is_moving() const
 	{
 		return this->get_army() != nullptr;
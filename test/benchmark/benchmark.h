@@ -0,0 +1,29 @@
+#pragma once
+
+namespace metternich::benchmark {
+
+extern int get_iteration_count();
+
+//reloads the benchmark scenario with the fixed random seed, so that the game state is the same each time
+extern void reset_state();
+
+//resets the state before each benchmark case
+struct fresh_state_fixture final
+{
+	fresh_state_fixture()
+	{
+		benchmark::reset_state();
+	}
+};
+
+//runs a function which doesn't change its own input state (e.g. recalculating cached values) for the configured number of iterations, recording its timings for the report
+extern void run(const std::string &name, const std::function<void()> &function);
+
+//runs a function which changes the game state (e.g. processing a turn), resetting the state before each further iteration without timing it, so that each iteration processes the same workload
+extern void run_mutating(const std::string &name, const std::function<void()> &function);
+extern void run_mutating_coro(const std::string &name, const std::function<QCoro::Task<void>()> &function);
+
+//as above, but with an untimed setup run after each reset, to bring the state into the one the function is to be timed in
+extern void run_mutating_coro(const std::string &name, const std::function<QCoro::Task<void>()> &setup_function, const std::function<QCoro::Task<void>()> &function);
+
+}
@@ -0,0 +1,221 @@
+#define BOOST_TEST_MODULE metternich_benchmark
+#include <boost/test/unit_test.hpp>
+
+#include "benchmark.h"
+
+#include "database/database.h"
+#include "database/database_setup.h"
+#include "domain/domain.h"
+#include "domain/domain_game_data.h"
+#include "game/game.h"
+#include "game/scenario.h"
+#include "infrastructure/building_slot.h"
+#include "map/province_pathfinder.h"
+#include "script/factor.h"
+#include "ui/text_cache.h"
+#include "util/exception_util.h"
+#include "util/random.h"
+
+#pragma warning(push, 0)
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#pragma warning(pop)
+
+//the benchmarks run on a scenario from the game's data, given by the METTERNICH_BENCHMARK_SCENARIO environment variable
+//the results are written as JSON to the file given by METTERNICH_BENCHMARK_OUTPUT, or to benchmark_results.json by default
+
+namespace metternich::benchmark {
+
+struct result final
+{
+	std::string name;
+	std::vector<int64_t> durations; //in nanoseconds
+	int64_t factor_memo_hits = 0;
+	int64_t factor_memo_misses = 0;
+};
+
+static std::vector<result> results;
+
+int get_iteration_count()
+{
+	static const int iteration_count = qEnvironmentVariableIsSet("METTERNICH_BENCHMARK_ITERATIONS") ? qEnvironmentVariableIntValue("METTERNICH_BENCHMARK_ITERATIONS") : 10;
+	return iteration_count;
+}
+
+static const domain *choose_player_domain()
+{
+	for (const domain *domain : game::get()->get_countries()) {
+		if (domain->get_game_data()->is_playable()) {
+			return domain;
+		}
+	}
+
+	throw std::runtime_error("No playable domain found for the benchmark scenario.");
+}
+
+void reset_state()
+{
+	QCoro::waitFor(game::get()->stop_coro());
+
+	//use a fixed seed so that the benchmarks process the same state on each run
+	random::get()->get_engine().seed(0);
+
+	const scenario *scenario = scenario::get(qEnvironmentVariable("METTERNICH_BENCHMARK_SCENARIO").toStdString());
+	QCoro::waitFor(game::get()->setup_scenario_coro(scenario));
+
+	game::get()->set_player_domain(benchmark::choose_player_domain());
+	game::get()->set_player_ai_controlled(true);
+
+	QCoro::waitFor(game::get()->start_coro());
+}
+
+static void run_iterations(const std::string &name, const std::function<void()> &setup_function, const std::function<void()> &function, const bool reset_each_iteration)
+{
+	result result;
+	result.name = name;
+
+	for (int i = 0; i < benchmark::get_iteration_count(); ++i) {
+		if (reset_each_iteration && i > 0) {
+			benchmark::reset_state();
+		}
+
+		if (setup_function) {
+			setup_function();
+		}
+
+		const int64_t factor_memo_hits = factor_memo_scope::get_hit_count();
+		const int64_t factor_memo_misses = factor_memo_scope::get_miss_count();
+
+		QElapsedTimer elapsed_timer;
+		elapsed_timer.start();
+
+		function();
+
+		result.durations.push_back(elapsed_timer.nsecsElapsed());
+		result.factor_memo_hits += factor_memo_scope::get_hit_count() - factor_memo_hits;
+		result.factor_memo_misses += factor_memo_scope::get_miss_count() - factor_memo_misses;
+	}
+
+	benchmark::results.push_back(std::move(result));
+}
+
+void run(const std::string &name, const std::function<void()> &function)
+{
+	benchmark::run_iterations(name, nullptr, function, false);
+}
+
+void run_mutating(const std::string &name, const std::function<void()> &function)
+{
+	benchmark::run_iterations(name, nullptr, function, true);
+}
+
+void run_mutating_coro(const std::string &name, const std::function<QCoro::Task<void>()> &function)
+{
+	benchmark::run_mutating(name, [&function]() {
+		QCoro::waitFor(function());
+	});
+}
+
+void run_mutating_coro(const std::string &name, const std::function<QCoro::Task<void>()> &setup_function, const std::function<QCoro::Task<void>()> &function)
+{
+	benchmark::run_iterations(name, [&setup_function]() {
+		QCoro::waitFor(setup_function());
+	}, [&function]() {
+		QCoro::waitFor(function());
+	}, true);
+}
+
+static void write_report()
+{
+	QJsonArray benchmarks_array;
+
+	for (const result &result : benchmark::results) {
+		if (result.durations.empty()) {
+			continue;
+		}
+
+		const int64_t total_duration = std::accumulate(result.durations.begin(), result.durations.end(), static_cast<int64_t>(0));
+
+		QJsonObject benchmark_object;
+		benchmark_object["name"] = QString::fromStdString(result.name);
+		benchmark_object["iterations"] = static_cast<qint64>(result.durations.size());
+		benchmark_object["total_ns"] = total_duration;
+		benchmark_object["mean_ns"] = total_duration / static_cast<int64_t>(result.durations.size());
+		benchmark_object["min_ns"] = *std::min_element(result.durations.begin(), result.durations.end());
+		benchmark_object["max_ns"] = *std::max_element(result.durations.begin(), result.durations.end());
+
+		//the factor memo counters are reported per benchmark, so that its hit rate can be seen for each of the code paths which use it
+		if (result.factor_memo_hits + result.factor_memo_misses > 0) {
+			benchmark_object["factor_memo_hits"] = result.factor_memo_hits;
+			benchmark_object["factor_memo_misses"] = result.factor_memo_misses;
+			benchmark_object["factor_memo_hit_rate"] = static_cast<double>(result.factor_memo_hits) / static_cast<double>(result.factor_memo_hits + result.factor_memo_misses);
+		}
+		benchmarks_array.append(benchmark_object);
+	}
+
+	QJsonObject counters_object;
+	counters_object["building_eligibility_cache_hits"] = building_eligibility_cache_scope::get_hit_count();
+	counters_object["building_eligibility_cache_misses"] = building_eligibility_cache_scope::get_miss_count();
+	counters_object["factor_memo_hits"] = factor_memo_scope::get_hit_count();
+	counters_object["factor_memo_misses"] = factor_memo_scope::get_miss_count();
+	counters_object["text_cache_hits"] = text_cache::get_hit_count();
+	counters_object["text_cache_misses"] = text_cache::get_miss_count();
+	counters_object["pathfinding_field_hits"] = province_pathfinder::get_field_hit_count();
+	counters_object["pathfinding_field_misses"] = province_pathfinder::get_field_miss_count();
+
+	QJsonObject report_object;
+	report_object["scenario"] = qEnvironmentVariable("METTERNICH_BENCHMARK_SCENARIO");
+	report_object["benchmarks"] = benchmarks_array;
+	report_object["counters"] = counters_object;
+
+	const QString output_filepath = qEnvironmentVariableIsSet("METTERNICH_BENCHMARK_OUTPUT") ? qEnvironmentVariable("METTERNICH_BENCHMARK_OUTPUT") : QString("benchmark_results.json");
+
+	QFile output_file(output_filepath);
+	if (!output_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		throw std::runtime_error(std::format("Failed to open benchmark output file \"{}\".", output_filepath.toStdString()));
+	}
+
+	output_file.write(QJsonDocument(report_object).toJson());
+}
+
+struct global_fixture final
+{
+	global_fixture()
+	{
+		if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+			qputenv("QT_QPA_PLATFORM", "offscreen");
+		}
+
+		this->application = std::make_unique<QApplication>(boost::unit_test::framework::master_test_suite().argc, boost::unit_test::framework::master_test_suite().argv);
+
+		if (!qEnvironmentVariableIsSet("METTERNICH_BENCHMARK_SCENARIO")) {
+			throw std::runtime_error("No benchmark scenario specified, the METTERNICH_BENCHMARK_SCENARIO environment variable must be set.");
+		}
+
+		database_setup::add_defines();
+		database_setup::register_enums();
+		QCoro::waitFor(database_setup::load());
+
+		//each benchmark case loads the scenario itself, so that it doesn't run on the state left behind by the previous one
+	}
+
+	~global_fixture()
+	{
+		try {
+			benchmark::write_report();
+		} catch (...) {
+			exception::report(std::current_exception());
+		}
+
+		QCoro::waitFor(game::get()->stop_coro());
+		database::get()->clear();
+	}
+
+	std::unique_ptr<QApplication> application;
+};
+
+BOOST_TEST_GLOBAL_FIXTURE(global_fixture);
+
+}
@@ -0,0 +1,99 @@
+#include <boost/test/unit_test.hpp>
+
+#include "benchmark.h"
+
+#include "domain/domain.h"
+#include "domain/domain_game_data.h"
+#include "domain/domain_military.h"
+#include "game/game.h"
+#include "map/province.h"
+#include "map/province_map_data.h"
+#include "map/province_pathfinder.h"
+#include "unit/civilian_unit.h"
+#include "unit/military_unit.h"
+
+using namespace metternich;
+
+namespace {
+
+//the capital provinces of all domains, used as path goals
+std::vector<const province *> get_goal_provinces()
+{
+	std::vector<const province *> goal_provinces;
+
+	for (const domain *domain : game::get()->get_domains()) {
+		const province *capital_province = domain->get_game_data()->get_capital_province();
+		if (capital_province != nullptr) {
+			goal_provinces.push_back(capital_province);
+		}
+	}
+
+	return goal_provinces;
+}
+
+//checks each step of the path against the unit's movement rules, returning the number of steps checked
+template <typename unit_type, typename can_move_function_type>
+int check_path(const unit_type *unit, const std::vector<const province *> &path, const province *goal, const can_move_function_type &can_move_to)
+{
+	const province *current_province = unit->get_province();
+
+	for (const province *step : path) {
+		BOOST_CHECK_MESSAGE(std::ranges::contains(current_province->get_map_data()->get_neighbor_provinces(), step), std::format("Path step \"{}\" does not border \"{}\".", step->get_identifier(), current_province->get_identifier()));
+		BOOST_CHECK_MESSAGE(can_move_to(step, current_province), std::format("Unit \"{}\" cannot move from \"{}\" to path step \"{}\".", unit->get_name(), current_province->get_identifier(), step->get_identifier()));
+		current_province = step;
+	}
+
+	if (!path.empty()) {
+		BOOST_CHECK(current_province == goal);
+	}
+
+	return static_cast<int>(path.size());
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(pathfinding_tests, benchmark::fresh_state_fixture)
+
+//compares the paths of every unit to every capital with the units' own movement rules; the scenario must have units with such paths, so that the test cannot pass without checking anything
+BOOST_AUTO_TEST_CASE(unit_path_test)
+{
+	const std::vector<const province *> goal_provinces = get_goal_provinces();
+	int checked_step_count = 0;
+
+	for (const domain *domain : game::get()->get_domains()) {
+		for (const qunique_ptr<military_unit> &military_unit : domain->get_military()->get_military_units()) {
+			if (military_unit->get_province() == nullptr) {
+				continue;
+			}
+
+			for (const province *goal : goal_provinces) {
+				const std::vector<const province *> path = province_pathfinder::get()->find_path(domain, military_unit->get_path_mode(), military_unit->get_province(), goal);
+
+				checked_step_count += check_path(military_unit.get(), path, goal, [&military_unit](const province *step, const province *current_province) {
+					return military_unit->can_move_to(step, current_province);
+				});
+			}
+		}
+
+		for (const qunique_ptr<civilian_unit> &civilian_unit : domain->get_game_data()->get_civilian_units()) {
+			if (civilian_unit->get_province() == nullptr) {
+				continue;
+			}
+
+			for (const province *goal : goal_provinces) {
+				const std::vector<const province *> path = province_pathfinder::get()->find_path(domain, province_path_mode::civilian, civilian_unit->get_province(), goal);
+
+				//civilian movement does not depend on where the unit is, other than not being able to move to its own province
+				checked_step_count += check_path(civilian_unit.get(), path, goal, [&civilian_unit](const province *step, const province *current_province) {
+					Q_UNUSED(current_province);
+
+					return civilian_unit->can_move_to(step);
+				});
+			}
+		}
+	}
+
+	BOOST_REQUIRE_GT(checked_step_count, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
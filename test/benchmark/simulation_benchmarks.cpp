@@ -0,0 +1,177 @@
+#include <boost/test/unit_test.hpp>
+
+#include "benchmark.h"
+
+#include "domain/domain.h"
+#include "domain/domain_diplomacy.h"
+#include "domain/domain_game_data.h"
+#include "domain/domain_military.h"
+#include "domain/domain_technology.h"
+#include "game/domain_event.h"
+#include "game/event_trigger.h"
+#include "game/game.h"
+#include "game/province_event.h"
+#include "map/map.h"
+#include "map/province.h"
+#include "map/province_pathfinder.h"
+#include "map/site.h"
+#include "map/site_game_data.h"
+#include "unit/military_unit.h"
+
+#pragma warning(push, 0)
+#include <QThreadPool>
+#pragma warning(pop)
+
+using namespace metternich;
+
+BOOST_FIXTURE_TEST_SUITE(simulation_benchmarks, benchmark::fresh_state_fixture)
+
+BOOST_AUTO_TEST_CASE(trade_benchmark)
+{
+	benchmark::run_mutating("game::do_trade", []() {
+		game::get()->do_trade();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(technology_spread_benchmark)
+{
+	benchmark::run_mutating_coro("domain_technology::do_technology_spread", []() -> QCoro::Task<void> {
+		for (const domain *domain : game::get()->get_domains()) {
+			co_await domain->get_technology()->do_technology_spread();
+		}
+	});
+}
+
+BOOST_AUTO_TEST_CASE(employment_benchmark)
+{
+	static constexpr size_t dirty_site_count = 8;
+
+	const std::function<QCoro::Task<void>()> do_population_employment = []() -> QCoro::Task<void> {
+		for (const domain *domain : game::get()->get_domains()) {
+			co_await domain->get_game_data()->do_population_employment();
+		}
+	};
+
+	//all sites start with their employment dirty, so the first pass after loading checks every one of them
+	benchmark::run_mutating_coro("domain_game_data::do_population_employment", do_population_employment);
+
+	benchmark::reset_state();
+
+	//a pass in a later turn, where employment has already settled and only a few sites changed since
+	benchmark::run_mutating_coro("domain_game_data::do_population_employment (incremental)", [&do_population_employment]() -> QCoro::Task<void> {
+		co_await game::get()->do_turn_coro();
+		co_await do_population_employment();
+
+		size_t dirtied_site_count = 0;
+		for (const site *site : map::get()->get_sites()) {
+			if (site->get_game_data()->get_population_units().empty()) {
+				continue;
+			}
+
+			site->get_game_data()->set_employment_dirty();
+
+			++dirtied_site_count;
+			if (dirtied_site_count == dirty_site_count) {
+				break;
+			}
+		}
+	}, do_population_employment);
+}
+
+BOOST_AUTO_TEST_CASE(population_promotion_benchmark)
+{
+	benchmark::run_mutating_coro("domain_game_data::do_population_promotion", []() -> QCoro::Task<void> {
+		for (const domain *domain : game::get()->get_domains()) {
+			co_await domain->get_game_data()->do_population_promotion();
+		}
+	});
+}
+
+BOOST_AUTO_TEST_CASE(commodity_output_benchmark)
+{
+	benchmark::run("site_game_data::calculate_commodity_outputs", []() {
+		for (const site *site : map::get()->get_sites()) {
+			site->get_game_data()->calculate_commodity_outputs();
+		}
+	});
+}
+
+BOOST_AUTO_TEST_CASE(event_check_benchmark)
+{
+	//per turn pulse checks include both the random and the MTTH events
+	benchmark::run_mutating_coro("domain_event::check_events_for_scope", []() -> QCoro::Task<void> {
+		for (const domain *domain : game::get()->get_domains()) {
+			co_await domain_event::check_events_for_scope(domain, event_trigger::per_turn_pulse);
+		}
+	});
+}
+
+BOOST_AUTO_TEST_CASE(province_event_check_benchmark)
+{
+	//province MTTH events can be checked once for each nearby province as the source
+	benchmark::run_mutating_coro("province_event::check_events_for_scope", []() -> QCoro::Task<void> {
+		for (const domain *domain : game::get()->get_domains()) {
+			for (const province *province : domain->get_game_data()->get_provinces()) {
+				co_await province_event::check_events_for_scope(province, event_trigger::per_turn_pulse);
+			}
+		}
+	});
+}
+
+BOOST_AUTO_TEST_CASE(diplomatic_map_benchmark)
+{
+	benchmark::run("domain_diplomacy::create_diplomatic_map_image", []() {
+		for (const domain *domain : game::get()->get_domains()) {
+			if (domain->get_game_data()->get_province_count() == 0) {
+				continue;
+			}
+
+			domain->get_diplomacy()->create_diplomatic_map_image();
+		}
+
+		//the images are finalized in the thread pool
+		QThreadPool::globalInstance()->waitForDone();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(domain_rank_benchmark)
+{
+	//the ranks only depend on the domains' scores and conditions, so recalculating them gives the same result each iteration
+	benchmark::run("game::calculate_domain_ranks", []() {
+		game::get()->calculate_domain_ranks();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(pathfinding_benchmark)
+{
+	//route every military unit to its domain's capital province, as the AI would when gathering its forces
+	std::vector<province_path_query> queries;
+	for (const domain *domain : game::get()->get_domains()) {
+		const province *capital_province = domain->get_game_data()->get_capital_province();
+		if (capital_province == nullptr) {
+			continue;
+		}
+
+		for (const qunique_ptr<military_unit> &military_unit : domain->get_military()->get_military_units()) {
+			if (military_unit->get_province() == nullptr) {
+				continue;
+			}
+
+			queries.push_back(province_path_query{ domain, military_unit->get_path_mode(), military_unit->get_province(), capital_province });
+		}
+	}
+
+	benchmark::run("province_pathfinder::find_paths", [&queries]() {
+		province_pathfinder::get()->invalidate();
+		province_pathfinder::get()->find_paths(queries);
+	});
+}
+
+BOOST_AUTO_TEST_CASE(turn_benchmark)
+{
+	benchmark::run_mutating_coro("game::do_turn_coro", []() -> QCoro::Task<void> {
+		co_await game::get()->do_turn_coro();
+	});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+#include <boost/test/unit_test.hpp>
+
+#include "domain/domain_diplomacy.h"
+
+using namespace metternich;
+
+namespace {
+
+//a 4x3 raster of three provinces, with two pixels without a province
+struct diplomatic_map_fixture final
+{
+	static inline const QColor first_color = QColor(255, 0, 0);
+	static inline const QColor second_color = QColor(0, 255, 0);
+	static inline const QColor third_color = QColor(0, 0, 255);
+
+	static void check_pixel(const QImage &image, const QPoint &pixel_pos, const QColor &expected_color)
+	{
+		BOOST_CHECK_MESSAGE(image.pixelColor(pixel_pos) == expected_color, std::format("Pixel ({}, {}) has color {} instead of {}.", pixel_pos.x(), pixel_pos.y(), image.pixelColor(pixel_pos).name(QColor::HexArgb).toStdString(), expected_color.name(QColor::HexArgb).toStdString()));
+	}
+
+	static void check_transparent_pixel(const QImage &image, const QPoint &pixel_pos)
+	{
+		BOOST_CHECK_MESSAGE(image.pixelColor(pixel_pos).alpha() == 0, std::format("Pixel ({}, {}) is not transparent.", pixel_pos.x(), pixel_pos.y()));
+	}
+
+	const QSize raster_size = QSize(4, 3);
+	const std::vector<int> province_raster = {
+		0, 0, 1, -1,
+		0, 2, 1, 1,
+		-1, 2, 2, 1
+	};
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(diplomatic_map_tests, diplomatic_map_fixture)
+
+BOOST_AUTO_TEST_CASE(compose_full_raster_test)
+{
+	//the second province has no color, as is the case for provinces not owned by the domain
+	const std::vector<QColor> province_colors = { diplomatic_map_fixture::first_color, QColor(), diplomatic_map_fixture::third_color };
+
+	const QImage image = domain_diplomacy::compose_diplomatic_map_image(this->province_raster, this->raster_size, QRect(QPoint(0, 0), this->raster_size), province_colors);
+
+	BOOST_REQUIRE(image.size() == this->raster_size);
+
+	diplomatic_map_fixture::check_pixel(image, QPoint(0, 0), diplomatic_map_fixture::first_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(1, 0), diplomatic_map_fixture::first_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(0, 1), diplomatic_map_fixture::first_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(1, 1), diplomatic_map_fixture::third_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(1, 2), diplomatic_map_fixture::third_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(2, 2), diplomatic_map_fixture::third_color);
+
+	diplomatic_map_fixture::check_transparent_pixel(image, QPoint(2, 0));
+	diplomatic_map_fixture::check_transparent_pixel(image, QPoint(3, 0));
+	diplomatic_map_fixture::check_transparent_pixel(image, QPoint(2, 1));
+	diplomatic_map_fixture::check_transparent_pixel(image, QPoint(3, 1));
+	diplomatic_map_fixture::check_transparent_pixel(image, QPoint(0, 2));
+	diplomatic_map_fixture::check_transparent_pixel(image, QPoint(3, 2));
+}
+
+BOOST_AUTO_TEST_CASE(compose_pixel_rect_test)
+{
+	const std::vector<QColor> province_colors = { diplomatic_map_fixture::first_color, QColor(), diplomatic_map_fixture::third_color };
+
+	const QImage image = domain_diplomacy::compose_diplomatic_map_image(this->province_raster, this->raster_size, QRect(1, 1, 2, 2), province_colors);
+
+	BOOST_REQUIRE(image.size() == QSize(2, 2));
+
+	diplomatic_map_fixture::check_pixel(image, QPoint(0, 0), diplomatic_map_fixture::third_color);
+	diplomatic_map_fixture::check_transparent_pixel(image, QPoint(1, 0));
+	diplomatic_map_fixture::check_pixel(image, QPoint(0, 1), diplomatic_map_fixture::third_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(1, 1), diplomatic_map_fixture::third_color);
+}
+
+BOOST_AUTO_TEST_CASE(compose_rect_beyond_raster_test)
+{
+	const std::vector<QColor> province_colors = { diplomatic_map_fixture::first_color, diplomatic_map_fixture::second_color, diplomatic_map_fixture::third_color };
+
+	//the rect can extend beyond the raster when the image size of a territory is rounded up, in which case the pixels outside the raster are left transparent
+	const QImage image = domain_diplomacy::compose_diplomatic_map_image(this->province_raster, this->raster_size, QRect(2, 1, 3, 3), province_colors);
+
+	BOOST_REQUIRE(image.size() == QSize(3, 3));
+
+	diplomatic_map_fixture::check_pixel(image, QPoint(0, 0), diplomatic_map_fixture::second_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(1, 0), diplomatic_map_fixture::second_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(0, 1), diplomatic_map_fixture::third_color);
+	diplomatic_map_fixture::check_pixel(image, QPoint(1, 1), diplomatic_map_fixture::second_color);
+
+	for (int y = 0; y < image.height(); ++y) {
+		diplomatic_map_fixture::check_transparent_pixel(image, QPoint(2, y));
+	}
+
+	for (int x = 0; x < image.width(); ++x) {
+		diplomatic_map_fixture::check_transparent_pixel(image, QPoint(x, 2));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+#include <boost/test/unit_test.hpp>
+
+#include "map/province.h"
+#include "map/province_adjacency_graph.h"
+#include "map/province_map_data.h"
+#include "map/province_pathfinder.h"
+
+using namespace metternich;
+
+namespace {
+
+//a small graph of provinces created in memory, so that no map is needed:
+//three water zones in a row (0-1-2), two bordering land provinces both on the last water zone (3, 4), a land province on the first water zone (5), and a water zone which only borders the first land province (6)
+struct province_pathfinder_fixture final
+{
+	static constexpr size_t province_count = 7;
+
+	province_pathfinder_fixture()
+	{
+		for (size_t i = 0; i < province_pathfinder_fixture::province_count; ++i) {
+			this->provinces.push_back(province::add("province_pathfinder_test_province_" + std::to_string(i), nullptr));
+		}
+
+		this->add_border(0, 1);
+		this->add_border(1, 2);
+		this->add_border(2, 3);
+		this->add_border(2, 4);
+		this->add_border(3, 4);
+		this->add_border(0, 5);
+		this->add_border(3, 6);
+
+		this->graph = std::make_unique<province_adjacency_graph>(this->provinces);
+	}
+
+	~province_pathfinder_fixture()
+	{
+		this->graph.reset();
+		province::clear();
+	}
+
+	void add_border(const size_t first_index, const size_t second_index)
+	{
+		this->provinces[first_index]->get_map_data()->add_border_with(this->provinces[second_index]);
+		this->provinces[second_index]->get_map_data()->add_border_with(this->provinces[first_index]);
+	}
+
+	//the mask for ships: water zones can be passed through, while land provinces can only be the start or end of a path
+	static std::vector<province_passability> create_water_passability_mask()
+	{
+		return {
+			province_passability::passable,
+			province_passability::passable,
+			province_passability::passable,
+			province_passability::endpoint,
+			province_passability::endpoint,
+			province_passability::endpoint,
+			province_passability::passable
+		};
+	}
+
+	std::unique_ptr<province_distance_field> calculate_distance_field(const std::vector<province_passability> &passability_mask, const int source_index) const
+	{
+		return province_pathfinder::calculate_distance_field(this->graph.get(), passability_mask, { source_index });
+	}
+
+	static void check_distances(const province_distance_field *field, const std::vector<int> &expected_distances)
+	{
+		for (size_t i = 0; i < expected_distances.size(); ++i) {
+			BOOST_CHECK_MESSAGE(field->get_distance(i) == expected_distances[i], std::format("Province {} has distance {} instead of {}.", i, field->get_distance(i), expected_distances[i]));
+		}
+	}
+
+	std::vector<province *> provinces;
+	std::unique_ptr<province_adjacency_graph> graph;
+};
+
+constexpr int unreachable = province_distance_field::unreachable;
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(province_pathfinder_tests, province_pathfinder_fixture)
+
+BOOST_AUTO_TEST_CASE(endpoint_source_test)
+{
+	const std::unique_ptr<province_distance_field> field = this->calculate_distance_field(province_pathfinder_fixture::create_water_passability_mask(), 3);
+
+	//paths can leave an endpoint source, but the other land provinces can only be reached through water
+	province_pathfinder_fixture::check_distances(field.get(), { 3, 2, 1, 0, 2, 4, 1 });
+
+	BOOST_CHECK_EQUAL(field->get_next_index(3), -1);
+	BOOST_CHECK_EQUAL(field->get_next_index(4), 2);
+	BOOST_CHECK_EQUAL(field->get_next_index(5), 0);
+	BOOST_CHECK_EQUAL(field->get_next_index(6), 3);
+}
+
+BOOST_AUTO_TEST_CASE(endpoint_pass_through_test)
+{
+	const std::unique_ptr<province_distance_field> field = this->calculate_distance_field(province_pathfinder_fixture::create_water_passability_mask(), 0);
+
+	//the water zone behind the first land province can only be reached through it, which an endpoint does not allow
+	province_pathfinder_fixture::check_distances(field.get(), { 0, 1, 2, 3, 3, 1, unreachable });
+
+	BOOST_CHECK_EQUAL(field->get_next_index(3), 2);
+	BOOST_CHECK_EQUAL(field->get_next_index(6), -1);
+}
+
+BOOST_AUTO_TEST_CASE(endpoint_single_move_test)
+{
+	std::vector<province_passability> passability_mask = province_pathfinder_fixture::create_water_passability_mask();
+	passability_mask[2] = province_passability::impassable;
+
+	const std::unique_ptr<province_distance_field> field = this->calculate_distance_field(passability_mask, 3);
+
+	//without the shared water zone, the bordering land provinces cannot be connected by a single move between them
+	province_pathfinder_fixture::check_distances(field.get(), { unreachable, unreachable, unreachable, 0, unreachable, unreachable, 1 });
+}
+
+BOOST_AUTO_TEST_CASE(impassable_goal_test)
+{
+	std::vector<province_passability> passability_mask = province_pathfinder_fixture::create_water_passability_mask();
+	passability_mask[3] = province_passability::impassable;
+
+	const std::unique_ptr<province_distance_field> field = this->calculate_distance_field(passability_mask, 3);
+
+	//an impassable source cannot be reached, not even from itself
+	province_pathfinder_fixture::check_distances(field.get(), std::vector<int>(province_pathfinder_fixture::province_count, unreachable));
+}
+
+BOOST_AUTO_TEST_CASE(impassable_province_test)
+{
+	std::vector<province_passability> passability_mask(province_pathfinder_fixture::province_count, province_passability::passable);
+	passability_mask[1] = province_passability::impassable;
+
+	const std::unique_ptr<province_distance_field> field = this->calculate_distance_field(passability_mask, 0);
+
+	province_pathfinder_fixture::check_distances(field.get(), { 0, unreachable, unreachable, unreachable, unreachable, 1, unreachable });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
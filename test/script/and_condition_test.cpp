@@ -0,0 +1,164 @@
+#include <boost/test/unit_test.hpp>
+
+#include "domain/domain.h"
+#include "script/condition/and_condition.h"
+#include "script/condition/scripted_condition.h"
+#include "script/context.h"
+
+using namespace metternich;
+
+namespace {
+
+//two domains and a scripted condition true only for the first one, created in memory so that no game data is needed
+struct and_condition_fixture final
+{
+	and_condition_fixture()
+	{
+		this->first_domain = domain::add("and_condition_test_first_domain", nullptr);
+		this->second_domain = domain::add("and_condition_test_second_domain", nullptr);
+
+		domain_scripted_condition *scripted_condition = domain_scripted_condition::add("and_condition_test_scripted_condition", nullptr);
+		gsml_data scripted_condition_data;
+		scripted_condition_data.add_property("domain", this->first_domain->get_identifier());
+		scripted_condition_data.process(scripted_condition);
+		scripted_condition->check();
+	}
+
+	~and_condition_fixture()
+	{
+		domain_scripted_condition::clear();
+		domain::clear();
+	}
+
+	static std::unique_ptr<const and_condition<domain>> create_conditions(const gsml_data &data)
+	{
+		auto conditions = std::make_unique<and_condition<domain>>();
+		conditions->process_gsml_data(data);
+		conditions->check_validity();
+		return conditions;
+	}
+
+	static gsml_data create_domain_data(const std::string &tag, const domain *domain)
+	{
+		gsml_data data(tag);
+		data.add_property("domain", domain->get_identifier());
+		return data;
+	}
+
+	//checks that the compiled sequence, the condition tree and the expected result all agree for the domain
+	static void check_conditions(const and_condition<domain> *conditions, const domain *domain, const bool expected_result)
+	{
+		BOOST_REQUIRE(conditions->is_compiled());
+
+		const read_only_context ctx(domain);
+		BOOST_CHECK_EQUAL(conditions->check_tree(domain, ctx), expected_result);
+		BOOST_CHECK_EQUAL(conditions->check_assignment(domain, ctx), expected_result);
+	}
+
+	const domain *first_domain = nullptr;
+	const domain *second_domain = nullptr;
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(and_condition_tests, and_condition_fixture)
+
+BOOST_AUTO_TEST_CASE(nested_and_condition_test)
+{
+	gsml_data inner_data = and_condition_fixture::create_domain_data("and", this->first_domain);
+	inner_data.add_child(and_condition_fixture::create_domain_data("and", this->first_domain));
+
+	gsml_data data;
+	data.add_child(std::move(inner_data));
+
+	const std::unique_ptr<const and_condition<domain>> conditions = and_condition_fixture::create_conditions(data);
+
+	//both levels of nesting are inlined into the sequence of the outer condition
+	BOOST_CHECK_EQUAL(conditions->get_child_conditions().size(), 1);
+	BOOST_CHECK_EQUAL(conditions->get_compiled_conditions().size(), 2);
+
+	and_condition_fixture::check_conditions(conditions.get(), this->first_domain, true);
+	and_condition_fixture::check_conditions(conditions.get(), this->second_domain, false);
+}
+
+BOOST_AUTO_TEST_CASE(scripted_condition_test)
+{
+	gsml_data data;
+	data.add_property("scripted_condition", "and_condition_test_scripted_condition");
+
+	const std::unique_ptr<const and_condition<domain>> conditions = and_condition_fixture::create_conditions(data);
+
+	BOOST_CHECK_EQUAL(conditions->get_compiled_conditions().size(), 1);
+	BOOST_CHECK(conditions->get_compiled_conditions().front() != conditions->get_child_conditions().front());
+
+	and_condition_fixture::check_conditions(conditions.get(), this->first_domain, true);
+	and_condition_fixture::check_conditions(conditions.get(), this->second_domain, false);
+}
+
+BOOST_AUTO_TEST_CASE(negated_scripted_condition_test)
+{
+	gsml_data data;
+	data.add_property("scripted_condition", gsml_operator::inequality, "and_condition_test_scripted_condition");
+
+	const std::unique_ptr<const and_condition<domain>> conditions = and_condition_fixture::create_conditions(data);
+
+	//a scripted condition with another operator than assignment cannot be inlined
+	BOOST_CHECK(conditions->get_compiled_conditions().front() == conditions->get_child_conditions().front());
+
+	and_condition_fixture::check_conditions(conditions.get(), this->first_domain, false);
+	and_condition_fixture::check_conditions(conditions.get(), this->second_domain, true);
+}
+
+BOOST_AUTO_TEST_CASE(or_condition_test)
+{
+	gsml_data or_data("or");
+	or_data.add_child(and_condition_fixture::create_domain_data("and", this->second_domain));
+	or_data.add_property("scripted_condition", "and_condition_test_scripted_condition");
+
+	gsml_data data;
+	data.add_child(std::move(or_data));
+
+	const std::unique_ptr<const and_condition<domain>> conditions = and_condition_fixture::create_conditions(data);
+
+	and_condition_fixture::check_conditions(conditions.get(), this->first_domain, true);
+	and_condition_fixture::check_conditions(conditions.get(), this->second_domain, true);
+}
+
+BOOST_AUTO_TEST_CASE(not_condition_test)
+{
+	gsml_data not_data("not");
+	not_data.add_child(and_condition_fixture::create_domain_data("and", this->second_domain));
+
+	gsml_data data;
+	data.add_child(std::move(not_data));
+	data.add_property("scripted_condition", "and_condition_test_scripted_condition");
+
+	const std::unique_ptr<const and_condition<domain>> conditions = and_condition_fixture::create_conditions(data);
+
+	and_condition_fixture::check_conditions(conditions.get(), this->first_domain, true);
+	and_condition_fixture::check_conditions(conditions.get(), this->second_domain, false);
+}
+
+BOOST_AUTO_TEST_CASE(mixed_condition_test)
+{
+	gsml_data not_data("not");
+	not_data.add_property("scripted_condition", "and_condition_test_scripted_condition");
+
+	gsml_data or_data("or");
+	or_data.add_child(std::move(not_data));
+	or_data.add_property("domain", this->first_domain->get_identifier());
+
+	gsml_data inner_data("and");
+	inner_data.add_child(std::move(or_data));
+	inner_data.add_property("scripted_condition", gsml_operator::inequality, "and_condition_test_scripted_condition");
+
+	gsml_data data;
+	data.add_child(std::move(inner_data));
+
+	const std::unique_ptr<const and_condition<domain>> conditions = and_condition_fixture::create_conditions(data);
+
+	and_condition_fixture::check_conditions(conditions.get(), this->first_domain, false);
+	and_condition_fixture::check_conditions(conditions.get(), this->second_domain, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()